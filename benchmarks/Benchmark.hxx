@@ -0,0 +1,340 @@
+/*!
+ * \file   benchmarks/Benchmark.hxx
+ * \brief  A minimal benchmark driver whose command line options and JSON
+ * output follow the conventions of the Google Benchmark library, so that
+ * the results can be compared using the tools provided by this library.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_BENCHMARKS_BENCHMARK_HXX
+#define LIB_MGIS_BENCHMARKS_BENCHMARK_HXX
+
+#include <regex>
+#include <ctime>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <thread>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <iostream>
+#include <optional>
+#include <exception>
+#include <functional>
+#include "MGIS/Config.hxx"
+#include "MGIS/Raise.hxx"
+
+namespace mgis::benchmarks {
+
+  //! \brief result of a benchmark
+  struct BenchmarkResult {
+    //! \brief name of the benchmark
+    std::string name;
+    //! \brief number of threads used by the benchmark
+    size_type threads = 1;
+    //! \brief number of iterations
+    size_type iterations = 0;
+    //! \brief wall clock time per iteration, in nanoseconds
+    real real_time = 0;
+    //! \brief processor time per iteration, in nanoseconds
+    real cpu_time = 0;
+    //! \brief number of items treated per second, if meaningful
+    std::optional<real> items_per_second;
+    //! \brief number of bytes processed per second, if meaningful
+    std::optional<real> bytes_per_second;
+    //! \brief error message, if the benchmark failed
+    std::optional<std::string> error_message;
+  };  // end of struct BenchmarkResult
+
+  /*!
+   * \brief description of a benchmark
+   */
+  struct Benchmark {
+    //! \brief name of the benchmark
+    std::string name;
+    /*!
+     * \brief function executing one iteration of the benchmark. This function
+     * shall throw an exception if the benchmark failed.
+     */
+    std::function<void()> run;
+    //! \brief number of items treated by one iteration, if meaningful
+    size_type items = 0;
+    //! \brief number of bytes processed by one iteration, if meaningful
+    size_type bytes = 0;
+    //! \brief number of threads used by the benchmark
+    size_type threads = 1;
+  };  // end of struct Benchmark
+
+  /*!
+   * \brief class in charge of running benchmarks and reporting their
+   * results.
+   *
+   * The following command line options are supported:
+   *
+   * - `--benchmark_filter=<regex>`: only run the benchmarks whose name
+   *   matches the given regular expression.
+   * - `--benchmark_min_time=<seconds>`: minimal time spent in each
+   *   benchmark.
+   * - `--benchmark_format=<console|json>`: format of the standard output.
+   * - `--benchmark_out=<file>`: file in which the results are written in the
+   *   JSON format.
+   * - `--benchmark_list_tests`: list the benchmarks without running them.
+   *
+   * Other arguments are returned by the `getArguments` method.
+   */
+  struct BenchmarkRunner {
+    /*!
+     * \brief constructor
+     * \param[in] argc: number of command line arguments
+     * \param[in] argv: command line arguments
+     */
+    BenchmarkRunner(const int argc, const char* const* const argv)
+        : executable(argv[0]) {
+      auto starts_with = [](const std::string& s, const char* const p) {
+        return s.compare(0, std::char_traits<char>::length(p), p) == 0;
+      };
+      auto value = [](const std::string& s) {
+        return s.substr(s.find('=') + 1);
+      };
+      for (int i = 1; i < argc; ++i) {
+        const auto a = std::string{argv[i]};
+        if (starts_with(a, "--benchmark_filter=")) {
+          this->filter = value(a);
+        } else if (starts_with(a, "--benchmark_min_time=")) {
+          this->minimum_time = std::stod(value(a));
+        } else if (starts_with(a, "--benchmark_format=")) {
+          this->format = value(a);
+          if ((this->format != "console") && (this->format != "json")) {
+            mgis::raise("BenchmarkRunner: unsupported format '" +
+                        this->format + "'");
+          }
+        } else if (starts_with(a, "--benchmark_out=")) {
+          this->output = value(a);
+        } else if (a == "--benchmark_list_tests") {
+          this->list_only = true;
+        } else if (starts_with(a, "--benchmark_")) {
+          mgis::raise("BenchmarkRunner: unsupported option '" + a + "'");
+        } else {
+          this->arguments.push_back(a);
+        }
+      }
+    }  // end of BenchmarkRunner
+    //! \return the command line arguments which are not benchmark options
+    const std::vector<std::string>& getArguments() const {
+      return this->arguments;
+    }  // end of getArguments
+    /*!
+     * \brief run the given benchmark, if selected by the filter
+     * \param[in] b: benchmark
+     */
+    void run(const Benchmark& b) {
+      if (!std::regex_search(b.name, std::regex(this->filter))) {
+        return;
+      }
+      if (this->list_only) {
+        std::cout << b.name << '\n';
+        return;
+      }
+      auto r = BenchmarkResult{};
+      r.name = b.name;
+      r.threads = b.threads;
+      try {
+        // warm-up
+        b.run();
+        auto n = size_type{1};
+        while (true) {
+          const auto c0 = std::clock();
+          const auto t0 = std::chrono::steady_clock::now();
+          for (size_type i = 0; i != n; ++i) {
+            b.run();
+          }
+          const auto t1 = std::chrono::steady_clock::now();
+          const auto c1 = std::clock();
+          const auto t = std::chrono::duration<real>(t1 - t0).count();
+          const auto c = static_cast<real>(c1 - c0) / CLOCKS_PER_SEC;
+          const auto rn = static_cast<real>(n);
+          if ((t >= this->minimum_time) || (n >= size_type{1} << 30)) {
+            r.iterations = n;
+            r.real_time = 1e9 * t / rn;
+            r.cpu_time = 1e9 * c / rn;
+            if ((b.items != 0) && (t > 0)) {
+              r.items_per_second = static_cast<real>(b.items) * rn / t;
+            }
+            if ((b.bytes != 0) && (t > 0)) {
+              r.bytes_per_second = static_cast<real>(b.bytes) * rn / t;
+            }
+            break;
+          }
+          // estimate the number of iterations required to reach the minimal
+          // time, with a safety margin
+          const auto f = (t > 0) ? 1.4 * this->minimum_time / t : 10.;
+          n = std::max(n + 1, static_cast<size_type>(rn * std::min(f, 10.)));
+        }
+      } catch (std::exception& e) {
+        r.error_message = e.what();
+      }
+      if (this->format == "console") {
+        this->writeConsoleReport(std::cout, r);
+      }
+      this->results.push_back(std::move(r));
+    }  // end of run
+    /*!
+     * \brief write the results
+     * \return the exit status of the program
+     */
+    int finalize() const {
+      if (this->list_only) {
+        return EXIT_SUCCESS;
+      }
+      if (this->format == "json") {
+        this->writeJSONReport(std::cout);
+      }
+      if (!this->output.empty()) {
+        std::ofstream out(this->output);
+        if (!out) {
+          std::cerr << "BenchmarkRunner: can't open file '" << this->output
+                    << "'\n";
+          return EXIT_FAILURE;
+        }
+        this->writeJSONReport(out);
+      }
+      for (const auto& r : this->results) {
+        if (r.error_message.has_value()) {
+          return EXIT_FAILURE;
+        }
+      }
+      return EXIT_SUCCESS;
+    }  // end of finalize
+
+   private:
+    /*!
+     * \brief write a line describing the result of a benchmark
+     * \param[in] os: output stream
+     * \param[in] r: result
+     */
+    static void writeConsoleReport(std::ostream& os,
+                                   const BenchmarkResult& r) {
+      os << std::left << std::setw(56) << r.name << std::right;
+      if (r.error_message.has_value()) {
+        os << " ERROR OCCURRED: '" << *(r.error_message) << "'\n";
+        return;
+      }
+      os << std::setw(14) << std::fixed << std::setprecision(0) << r.real_time
+         << " ns" << std::setw(14) << r.cpu_time << " ns" << std::setw(12)
+         << r.iterations;
+      os << std::defaultfloat << std::setprecision(4);
+      if (r.items_per_second.has_value()) {
+        os << " items_per_second=" << *(r.items_per_second) << "/s";
+      }
+      if (r.bytes_per_second.has_value()) {
+        os << " bytes_per_second=" << *(r.bytes_per_second) << "/s";
+      }
+      os << '\n';
+    }  // end of writeConsoleReport
+    /*!
+     * \brief write a string in the JSON format
+     * \param[in] os: output stream
+     * \param[in] s: string
+     */
+    static void writeJSONString(std::ostream& os, const std::string& s) {
+      os << '"';
+      for (const auto c : s) {
+        if ((c == '"') || (c == '\\')) {
+          os << '\\' << c;
+        } else if (c == '\n') {
+          os << "\\n";
+        } else {
+          os << c;
+        }
+      }
+      os << '"';
+    }  // end of writeJSONString
+    /*!
+     * \brief write the results in the JSON format
+     * \param[in] os: output stream
+     */
+    void writeJSONReport(std::ostream& os) const {
+      const auto now = std::time(nullptr);
+      char date[64];
+      std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S",
+                    std::localtime(&now));
+      os << "{\n"
+         << "  \"context\": {\n"
+         << "    \"date\": \"" << date << "\",\n"
+         << "    \"executable\": ";
+      writeJSONString(os, this->executable);
+      os << ",\n"
+         << "    \"num_cpus\": " << std::thread::hardware_concurrency()
+         << ",\n"
+#ifdef NDEBUG
+         << "    \"library_build_type\": \"release\"\n"
+#else
+         << "    \"library_build_type\": \"debug\"\n"
+#endif
+         << "  },\n"
+         << "  \"benchmarks\": [";
+      os << std::setprecision(17);
+      auto first = true;
+      for (const auto& r : this->results) {
+        os << (first ? "\n" : ",\n") << "    {\n"
+           << "      \"name\": ";
+        writeJSONString(os, r.name);
+        os << ",\n      \"run_name\": ";
+        writeJSONString(os, r.name);
+        os << ",\n"
+           << "      \"run_type\": \"iteration\",\n"
+           << "      \"repetitions\": 1,\n"
+           << "      \"repetition_index\": 0,\n"
+           << "      \"threads\": " << r.threads << ",\n";
+        if (r.error_message.has_value()) {
+          os << "      \"error_occurred\": true,\n"
+             << "      \"error_message\": ";
+          writeJSONString(os, *(r.error_message));
+          os << ",\n";
+        }
+        os << "      \"iterations\": " << r.iterations << ",\n"
+           << "      \"real_time\": " << r.real_time << ",\n"
+           << "      \"cpu_time\": " << r.cpu_time << ",\n"
+           << "      \"time_unit\": \"ns\"";
+        if (r.items_per_second.has_value()) {
+          os << ",\n      \"items_per_second\": " << *(r.items_per_second);
+        }
+        if (r.bytes_per_second.has_value()) {
+          os << ",\n      \"bytes_per_second\": " << *(r.bytes_per_second);
+        }
+        os << "\n    }";
+        first = false;
+      }
+      os << "\n  ]\n}\n";
+    }  // end of writeJSONReport
+    //! \brief name of the executable
+    const std::string executable;
+    //! \brief arguments which are not benchmark options
+    std::vector<std::string> arguments;
+    //! \brief regular expression used to select the benchmarks
+    std::string filter = ".";
+    //! \brief minimal time spent in each benchmark, in seconds
+    real minimum_time = 0.5;
+    //! \brief format of the standard output
+    std::string format = "console";
+    //! \brief output file
+    std::string output;
+    //! \brief if true, the benchmarks are listed but not run
+    bool list_only = false;
+    //! \brief results
+    std::vector<BenchmarkResult> results;
+  };  // end of struct BenchmarkRunner
+
+}  // end of namespace mgis::benchmarks
+
+#endif /* LIB_MGIS_BENCHMARKS_BENCHMARK_HXX */
@@ -0,0 +1,375 @@
+/*!
+ * \file   benchmarks/IntegrationBenchmarks.cxx
+ * \brief  Benchmarks of the integration of behaviours and of the associated
+ * operations (update, revert, rotations, finite strain conversions).
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+#include <thread>
+#include <cstdlib>
+#include <utility>
+#include <iostream>
+#include <algorithm>
+#include <functional>
+#include "MGIS/Raise.hxx"
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/FiniteStrainSupport.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+#include "Benchmark.hxx"
+
+namespace mgis::benchmarks {
+
+  using namespace mgis::behaviour;
+
+  /*!
+   * \brief a material data manager and the behaviour it refers to. The
+   * behaviour is held by a shared pointer since the material data manager
+   * keeps a reference to it.
+   */
+  struct BenchmarkMaterial {
+    //! \brief name of the behaviour
+    std::string name;
+    //! \brief behaviour
+    std::shared_ptr<Behaviour> b;
+    //! \brief material data manager
+    std::shared_ptr<MaterialDataManager> m;
+    //! \brief time increment
+    real dt;
+  };  // end of struct BenchmarkMaterial
+
+  /*!
+   * \return the number of values stored per integration point in a material
+   * state manager and copied by the `update` and `revert` functions.
+   * \param[in] s: material state manager
+   */
+  static size_type getStateSize(const MaterialStateManager& s) {
+    auto n = s.gradients_stride + s.thermodynamic_forces_stride +
+             s.internal_state_variables_stride;
+    if (!s.stored_energies.empty()) {
+      ++n;
+    }
+    if (!s.dissipated_energies.empty()) {
+      ++n;
+    }
+    return n;
+  }  // end of getStateSize
+
+  /*!
+   * \brief impose a uniaxial loading at the end of the time step.
+   * \param[in] m: material data manager
+   * \param[in] v: axial strain
+   *
+   * For finite strain behaviours, the deformation gradient is set to the
+   * identity at the beginning of the time step and the axial component of the
+   * deformation gradient is set to `1 + v` at the end of the time step.
+   */
+  static void setUniaxialLoading(MaterialDataManager& m, const real v) {
+    const auto gs = m.s1.gradients_stride;
+    const auto fs = m.b.btype == Behaviour::STANDARDFINITESTRAINBEHAVIOUR;
+    for (size_type i = 0; i != m.n; ++i) {
+      auto* const g0 = m.s0.gradients.data() + i * gs;
+      auto* const g1 = m.s1.gradients.data() + i * gs;
+      std::fill(g0, g0 + gs, real{0});
+      std::fill(g1, g1 + gs, real{0});
+      if (fs) {
+        g0[0] = g0[1] = g0[2] = real{1};
+        g1[0] = real{1} + v;
+        g1[1] = g1[2] = real{1};
+      } else {
+        g1[0] = v;
+      }
+    }
+  }  // end of setUniaxialLoading
+
+  /*!
+   * \brief set a tensorial internal state variable to the identity at the
+   * beginning of the time step.
+   * \param[in] m: material data manager
+   * \param[in] n: name of the internal state variable
+   */
+  static void setIdentity(MaterialDataManager& m, const std::string& n) {
+    const auto o = getVariableOffset(m.b.isvs, n, m.b.hypothesis);
+    const auto is = m.s0.internal_state_variables_stride;
+    for (size_type i = 0; i != m.n; ++i) {
+      auto* const F = m.s0.internal_state_variables.data() + i * is + o;
+      F[0] = F[1] = F[2] = real{1};
+      std::fill(F + 3, F + 9, real{0});
+    }
+  }  // end of setIdentity
+
+  /*!
+   * \brief load a behaviour and build a material data manager.
+   * \param[in] l: library
+   * \param[in] n: behaviour name
+   * \param[in] nipts: number of integration points
+   * \param[in] mps: values of the material properties
+   * \param[in] eps: axial strain imposed at the end of the time step
+   * \param[in] dt: time increment
+   */
+  static BenchmarkMaterial makeBenchmarkMaterial(
+      const std::string& l,
+      const std::string& n,
+      const size_type nipts,
+      const std::vector<std::pair<std::string, real>>& mps,
+      const real eps,
+      const real dt) {
+    auto r = BenchmarkMaterial{};
+    r.name = n;
+    r.b = std::make_shared<Behaviour>(
+        load(l, n, Hypothesis::TRIDIMENSIONAL));
+    r.m = std::make_shared<MaterialDataManager>(*(r.b), nipts);
+    r.dt = dt;
+    for (auto& s : {&(r.m->s0), &(r.m->s1)}) {
+      for (const auto& mp : mps) {
+        setMaterialProperty(*s, mp.first, mp.second);
+      }
+      for (const auto& esv : r.b->esvs) {
+        if (esv.name == "Temperature") {
+          setExternalStateVariable(*s, "Temperature", 293.15);
+        }
+      }
+    }
+    setUniaxialLoading(*(r.m), eps);
+    if (n == "FiniteStrainSingleCrystal") {
+      setIdentity(*(r.m), "Fe");
+    }
+    return r;
+  }  // end of makeBenchmarkMaterial
+
+  /*!
+   * \brief check the result of a behaviour integration
+   * \param[in] r: exit status
+   */
+  static void checkIntegrationResult(const int r) {
+    if (r == -1) {
+      mgis::raise("behaviour integration failed");
+    }
+  }  // end of checkIntegrationResult
+
+  /*!
+   * \brief add the benchmarks of the sequential integration of a behaviour
+   * \param[in] r: benchmark runner
+   * \param[in] bm: material
+   */
+  static void runSequentialIntegrationBenchmark(BenchmarkRunner& r,
+                                                const BenchmarkMaterial& bm) {
+    auto m = bm.m;
+    const auto dt = bm.dt;
+    r.run({"integrate/" + bm.name,
+           [m, dt] {
+             const auto it =
+                 IntegrationType::INTEGRATION_CONSISTENT_TANGENT_OPERATOR;
+             checkIntegrationResult(integrate(*m, it, dt, 0, m->n));
+           },
+           m->n});
+  }  // end of runSequentialIntegrationBenchmark
+
+  /*!
+   * \brief add the benchmarks of the parallel integration of a behaviour
+   * using an increasing number of threads.
+   * \param[in] r: benchmark runner
+   * \param[in] bm: material
+   */
+  static void runThreadScalingBenchmarks(BenchmarkRunner& r,
+                                         const BenchmarkMaterial& bm) {
+    auto m = bm.m;
+    const auto dt = bm.dt;
+    const auto nmax =
+        std::max(size_type{1},
+                 static_cast<size_type>(std::thread::hardware_concurrency()));
+    auto nthreads = std::vector<size_type>{};
+    for (size_type nt = 1; nt < nmax; nt *= 2) {
+      nthreads.push_back(nt);
+    }
+    nthreads.push_back(nmax);
+    for (const auto nt : nthreads) {
+      auto p = std::make_shared<ThreadPool>(nt);
+      r.run({"integrate/" + bm.name + "/threads:" + std::to_string(nt),
+             [p, m, dt] {
+               const auto it =
+                   IntegrationType::INTEGRATION_CONSISTENT_TANGENT_OPERATOR;
+               checkIntegrationResult(integrate(*p, *m, it, dt));
+             },
+             m->n, 0, nt});
+    }
+  }  // end of runThreadScalingBenchmarks
+
+  /*!
+   * \brief add the benchmarks of the `update` and `revert` functions
+   * \param[in] r: benchmark runner
+   * \param[in] bm: material
+   */
+  static void runUpdateBenchmarks(BenchmarkRunner& r,
+                                  const BenchmarkMaterial& bm) {
+    auto m = bm.m;
+    // values are read in one state and written in the other one
+    const auto bytes = 2 * m->n * getStateSize(m->s1) * sizeof(real);
+    r.run({"update/" + bm.name,
+           [m] {
+             m->setUpdatePolicy(MaterialDataManager::UpdatePolicy::COPY_VALUES);
+             update(*m);
+           },
+           m->n, bytes});
+    r.run({"update/" + bm.name + "/swap_buffers",
+           [m] {
+             m->setUpdatePolicy(
+                 MaterialDataManager::UpdatePolicy::SWAP_BUFFERS);
+             update(*m);
+           },
+           m->n, bytes});
+    r.run({"revert/" + bm.name, [m] { revert(*m); }, m->n, bytes});
+    m->setUpdatePolicy(MaterialDataManager::UpdatePolicy::COPY_VALUES);
+  }  // end of runUpdateBenchmarks
+
+  /*!
+   * \brief add the benchmarks of the rotation functions
+   * \param[in] r: benchmark runner
+   * \param[in] bm: material
+   */
+  static void runRotationBenchmarks(BenchmarkRunner& r,
+                                    const BenchmarkMaterial& bm) {
+    auto m = bm.m;
+    const auto& b = *(bm.b);
+    const auto n = m->n;
+    const auto gs = getArraySize(b.gradients, b.hypothesis);
+    const auto ts = getArraySize(b.thermodynamic_forces, b.hypothesis);
+    const auto ks = getTangentOperatorArraySize(b);
+    // a rotation of 30 degrees around the third axis
+    const auto c = std::sqrt(real{3}) / 2;
+    const auto s = real{1} / 2;
+    const auto R = std::vector<real>{c, s, 0, -s, c, 0, 0, 0, 1};
+    auto Rs = std::make_shared<std::vector<real>>(9 * n);
+    for (size_type i = 0; i != n; ++i) {
+      std::copy(R.begin(), R.end(), Rs->begin() + 9 * i);
+    }
+    auto R1 = std::make_shared<std::vector<real>>(R);
+    auto g = std::make_shared<std::vector<real>>(
+        m->s1.gradients.begin(), m->s1.gradients.end());
+    auto tf = std::make_shared<std::vector<real>>(ts * n, real{1});
+    auto K = std::make_shared<std::vector<real>>(ks * n, real{1});
+    auto out_g = std::make_shared<std::vector<real>>(gs * n);
+    auto out_tf = std::make_shared<std::vector<real>>(ts * n);
+    auto out_K = std::make_shared<std::vector<real>>(ks * n);
+    auto bp = bm.b;
+    for (const auto& rotation : {std::make_pair("uniform", R1),  //
+                                 std::make_pair("per_point", Rs)}) {
+      const auto suffix = "/" + bm.name + "/" + rotation.first;
+      const auto rv = rotation.second;
+      r.run({"rotateGradients" + suffix,
+             [bp, g, out_g, rv] {
+               rotateGradients(*out_g, *bp, *g, *rv);
+             },
+             n, 2 * gs * n * sizeof(real)});
+      r.run({"rotateThermodynamicForces" + suffix,
+             [bp, tf, out_tf, rv] {
+               rotateThermodynamicForces(*out_tf, *bp, *tf, *rv);
+             },
+             n, 2 * ts * n * sizeof(real)});
+      r.run({"rotateTangentOperatorBlocks" + suffix,
+             [bp, K, out_K, rv] {
+               rotateTangentOperatorBlocks(*out_K, *bp, *K, *rv);
+             },
+             n, 2 * ks * n * sizeof(real)});
+    }
+  }  // end of runRotationBenchmarks
+
+  /*!
+   * \brief add the benchmark of the conversion of the Cauchy stress to the
+   * first Piola-Kirchhoff stress
+   * \param[in] r: benchmark runner
+   * \param[in] bm: material
+   */
+  static void runFiniteStrainStressConversionBenchmark(
+      BenchmarkRunner& r, const BenchmarkMaterial& bm) {
+    auto m = bm.m;
+    const auto ts = getTensorSize(m->b.hypothesis);
+    auto P = std::make_shared<std::vector<real>>(ts * m->n);
+    r.run({"convertFiniteStrainStress/" + bm.name + "/PK1",
+           [m, P] {
+             auto s = mgis::span<real>(*P);
+             convertFiniteStrainStress(s, *m, FiniteStrainStress::PK1);
+           },
+           m->n,
+           (m->s1.gradients_stride + m->s1.thermodynamic_forces_stride + ts) *
+               m->n * sizeof(real)});
+  }  // end of runFiniteStrainStressConversionBenchmark
+
+}  // end of namespace mgis::benchmarks
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::benchmarks;
+  try {
+    auto r = BenchmarkRunner(argc, argv);
+    const auto& args = r.getArguments();
+    if ((args.size() != 1) && (args.size() != 2)) {
+      std::cerr << "IntegrationBenchmarks: invalid number of arguments\n"
+                << "usage: IntegrationBenchmarks [--benchmark_*=...] "
+                   "library [number_of_integration_points]\n";
+      return EXIT_FAILURE;
+    }
+    const auto& l = args[0];
+    const auto n = static_cast<size_type>(
+        args.size() == 2 ? std::stoul(args[1]) : 10000);
+    const auto materials = std::vector<BenchmarkMaterial>{
+        makeBenchmarkMaterial(l, "Elasticity", n,
+                              {{"YoungModulus", 150e9}, {"PoissonRatio", 0.3}},
+                              1e-3, 1),
+        makeBenchmarkMaterial(l, "Plasticity", n, {}, 2e-2, 1),
+        makeBenchmarkMaterial(l, "Norton", n, {}, 5e-5, 180),
+        makeBenchmarkMaterial(l, "Gurson", n, {}, 5e-3, 1),
+        makeBenchmarkMaterial(l, "FiniteStrainSingleCrystal", n,
+                              {{"YoungModulus1", 208000},
+                               {"YoungModulus2", 208000},
+                               {"YoungModulus3", 208000},
+                               {"PoissonRatio12", 0.3},
+                               {"PoissonRatio23", 0.3},
+                               {"PoissonRatio13", 0.3},
+                               {"ShearModulus12", 80000},
+                               {"ShearModulus23", 80000},
+                               {"ShearModulus13", 80000},
+                               {"m", 10},
+                               {"K", 25},
+                               {"C", 0},
+                               {"R0", 66.62},
+                               {"Q", 11.43},
+                               {"b", 2.1},
+                               {"d1", 494}},
+                              1e-3, 1)};
+    for (const auto& bm : materials) {
+      runSequentialIntegrationBenchmark(r, bm);
+    }
+    for (const auto& bm : materials) {
+      if ((bm.name == "Norton") || (bm.name == "FiniteStrainSingleCrystal")) {
+        runThreadScalingBenchmarks(r, bm);
+      }
+    }
+    for (const auto& bm : materials) {
+      runUpdateBenchmarks(r, bm);
+    }
+    for (const auto& bm : materials) {
+      if (bm.name == "FiniteStrainSingleCrystal") {
+        runRotationBenchmarks(r, bm);
+        runFiniteStrainStressConversionBenchmark(r, bm);
+      }
+    }
+    return r.finalize();
+  } catch (std::exception& e) {
+    std::cerr << e.what() << std::endl;
+  }
+  return EXIT_FAILURE;
+}
@@ -182,6 +182,8 @@ mgis_bv_material_data_manager_get_time_step_scaling_factor(
  * \brief return the tangent operator
  * \param[out] K: tangent operator
  * \param[in]  d: behaviour data
+ * \note this function fails if the tangent operator blocks are stored in
+ * packed form.
  */
 MGIS_C_EXPORT mgis_status mgis_bv_material_data_manager_get_tangent_operator(
     mgis_real * *const, mgis_bv_MaterialDataManager* const);
@@ -107,6 +107,9 @@ mgis_bv_material_state_manager_get_number_of_integration_points(
 /*!
  * \param[out] g: a pointer to the array of gradients
  * \param[in]  s: state manager
+ *
+ * \note this function fails if the gradients are stored in single
+ * precision.
  */
 MGIS_C_EXPORT mgis_status mgis_bv_material_state_manager_get_gradients(
     mgis_real**, mgis_bv_MaterialStateManager* const);
@@ -119,6 +122,9 @@ MGIS_C_EXPORT mgis_status mgis_bv_material_state_manager_get_gradients_stride(
 /*!
  * \param[out] f: a pointer to the array of thermodynamic_forces
  * \param[in]  s: state manager
+ *
+ * \note this function fails if the thermodynamic forces are stored in single
+ * precision.
  */
 MGIS_C_EXPORT mgis_status
 mgis_bv_material_state_manager_get_thermodynamic_forces(
@@ -134,6 +140,9 @@ mgis_bv_material_state_manager_get_thermodynamic_forces_stride(
 /*!
  * \param[out] ivs: a pointer to the array of internal state variables
  * \param[in]  s: state manager
+ *
+ * \note this function fails if the internal state variables are stored in
+ * single precision.
  */
 MGIS_C_EXPORT mgis_status
 mgis_bv_material_state_manager_get_internal_state_variables(
@@ -299,6 +299,13 @@ mgis_status mgis_bv_material_data_manager_get_tangent_operator(
     *K = nullptr;
     return mgis_report_failure("invalid argument (behaviour data is null)");
   }
+  if (d->tangent_operator_storage !=
+      mgis::behaviour::TangentOperatorStorage::FULL_BLOCKS) {
+    *K = nullptr;
+    return mgis_report_failure(
+        "the tangent operator blocks are stored in packed form and can't be "
+        "exposed as full blocks");
+  }
   auto* const Kv = d->K.data();
   if (Kv == nullptr) {
     *K = nullptr;
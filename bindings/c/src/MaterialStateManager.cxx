@@ -12,10 +12,29 @@
  *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
  */
 
+#include <string>
 #include "MGIS/Behaviour/MaterialStateManager.h"
 
 extern "C" {
 
+/*!
+ * \return a failure if the given values are stored in single precision, and
+ * thus can't be exposed as an array of `mgis_real`.
+ * \param[in] s: state manager
+ * \param[in] n: name of the values
+ */
+static mgis_status checkDoublePrecision(
+    const mgis_bv_MaterialStateManager* const s, const char* const n) {
+  if (s->precision !=
+      mgis::behaviour::StateStoragePrecision::DOUBLE_PRECISION) {
+    const auto msg = std::string("the ") + n +
+                     " are stored in single precision and can't be exposed "
+                     "as an array of double precision values";
+    return mgis_report_failure(msg.c_str());
+  }
+  return mgis_report_success();
+}  // end of checkDoublePrecision
+
 mgis_status mgis_bv_material_state_manager_initializer_bind_gradients(
     mgis_bv_MaterialStateManagerInitializer* i,
     mgis_real* const p,
@@ -148,6 +167,11 @@ mgis_status mgis_bv_material_state_manager_get_gradients(
     *g = nullptr;
     return mgis_report_failure("null state manager");
   }
+  const auto status = checkDoublePrecision(s, "gradients");
+  if (status.exit_status != MGIS_SUCCESS) {
+    *g = nullptr;
+    return status;
+  }
   *g = s->gradients.data();
   if (*g == nullptr) {
     return mgis_report_failure("no gradients defined");
@@ -171,6 +195,11 @@ mgis_status mgis_bv_material_state_manager_get_thermodynamic_forces(
     *f = nullptr;
     return mgis_report_failure("null state manager");
   }
+  const auto status = checkDoublePrecision(s, "thermodynamic forces");
+  if (status.exit_status != MGIS_SUCCESS) {
+    *f = nullptr;
+    return status;
+  }
   *f = s->thermodynamic_forces.data();
   if (*f == nullptr) {
     return mgis_report_failure("no thermodynamic forces defined");
@@ -194,6 +223,11 @@ mgis_status mgis_bv_material_state_manager_get_internal_state_variables(
     *ivs = nullptr;
     return mgis_report_failure("null state manager");
   }
+  const auto status = checkDoublePrecision(s, "internal state variables");
+  if (status.exit_status != MGIS_SUCCESS) {
+    *ivs = nullptr;
+    return status;
+  }
   *ivs = s->internal_state_variables.data();
   if (*ivs == nullptr) {
     return mgis_report_failure("no internal state variables defined");
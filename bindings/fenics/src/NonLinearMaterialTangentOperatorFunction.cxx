@@ -19,6 +19,7 @@
 
 #include <dolfin/mesh/Cell.h>
 #include <dolfin/fem/FiniteElement.h>
+#include "MGIS/Raise.hxx"
 #include "MGIS/Behaviour/MaterialDataManager.hxx"
 #include "MGIS/Behaviour/Integrate.hxx"
 #include "MGIS/FEniCS/NonLinearMaterial.hxx"
@@ -34,6 +35,12 @@ namespace mgis {
         const dolfin::Cell& c,
         const double* nc,
         const ufc::cell&) const {
+      if (this->m.tangent_operator_storage !=
+          mgis::behaviour::TangentOperatorStorage::FULL_BLOCKS) {
+        mgis::raise(
+            "NonLinearMaterialTangentOperatorFunction::restrict: "
+            "the tangent operator blocks shall not be stored in packed form");
+      }
       // behaviour integration
       this->m.update(c, nc);
       const auto gs = this->m.s1.gradients_stride;
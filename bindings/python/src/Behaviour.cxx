@@ -19,6 +19,7 @@
 #include "MGIS/Python/NumPySupport.hxx"
 #include "MGIS/Raise.hxx"
 #include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/PersistentBehaviourCache.hxx"
 
 // forward declaration
 void declareBehaviour();
@@ -500,6 +501,10 @@ void declareBehaviour() {
       "when loading the behaviour)");
   boost::python::def("load", load_ptr);
   boost::python::def("load", load_ptr2);
+  boost::python::def("usePersistentBehaviourCache",
+                     mgis::behaviour::usePersistentBehaviourCache);
+  boost::python::def("isPersistentBehaviourCacheUsed",
+                     mgis::behaviour::isPersistentBehaviourCacheUsed);
   boost::python::def("setParameter", setParameter1);
   boost::python::def("setIntegerParameter", setParameter2);
   boost::python::def("setUnsignedShortParameter", setParameter3);
@@ -140,6 +140,15 @@ MaterialDataManager_executePostProcessing3(
   return mgis::behaviour::executePostProcessing(output, t, m, n);
 }
 
+static boost::python::list BehaviourIntegrationProfile_getRdtHistogram(
+    const mgis::behaviour::BehaviourIntegrationProfile& p) {
+  boost::python::list l;
+  for (const auto v : p.rdt_histogram) {
+    l.append(v);
+  }
+  return l;
+}
+
 void declareIntegrate() {
   using namespace mgis::behaviour;
 
@@ -182,7 +191,43 @@ void declareIntegrate() {
       .add_property("integration_type",
                     &BehaviourIntegrationOptions::integration_type)
       .add_property("compute_speed_of_sound",
-                    &BehaviourIntegrationOptions::compute_speed_of_sound);
+                    &BehaviourIntegrationOptions::compute_speed_of_sound)
+      .add_property("maximum_number_of_substeps",
+                    &BehaviourIntegrationOptions::maximum_number_of_substeps)
+      .add_property("stop_on_failure",
+                    &BehaviourIntegrationOptions::stop_on_failure)
+      .add_property("profile", &BehaviourIntegrationOptions::profile);
+
+  boost::python::class_<BehaviourIntegrationProfile>(
+      "BehaviourIntegrationProfile")
+      .add_property("number_of_integration_points",
+                    &BehaviourIntegrationProfile::number_of_integration_points)
+      .add_property("number_of_unreliable_results",
+                    &BehaviourIntegrationProfile::number_of_unreliable_results)
+      .add_property("number_of_failures",
+                    &BehaviourIntegrationProfile::number_of_failures)
+      .add_property("wall_time", &BehaviourIntegrationProfile::wall_time)
+      .add_property("data_access_time",
+                    &BehaviourIntegrationProfile::data_access_time)
+      .add_property("behaviour_time",
+                    &BehaviourIntegrationProfile::behaviour_time)
+      .add_property("rdt_histogram",
+                    &BehaviourIntegrationProfile_getRdtHistogram);
+
+  boost::python::def("getNumberOfIntegrationPointsPerSecond",
+                     getNumberOfIntegrationPointsPerSecond);
+
+  boost::python::class_<BehaviourIntegrationFailure>(
+      "BehaviourIntegrationFailure")
+      .add_property("n", &BehaviourIntegrationFailure::n,
+                    "number of the integration point that failed")
+      .add_property("exit_status", &BehaviourIntegrationFailure::exit_status)
+      .add_property("error_message",
+                    &BehaviourIntegrationFailure::error_message);
+
+  // wrapping std::vector<BehaviourIntegrationFailure>
+  mgis::python::initializeVectorConverter<
+      std::vector<BehaviourIntegrationFailure>>();
 
   boost::python::class_<BehaviourIntegrationResult>(
       "BehaviourIntegrationResult")
@@ -199,7 +244,9 @@ void declareIntegrate() {
                     "or number of the last integration point \n"
                     "that reported unreliable results")
       .add_property("error_message",
-                    &BehaviourIntegrationResult::error_message);
+                    &BehaviourIntegrationResult::error_message)
+      .add_property("failures", &BehaviourIntegrationResult::failures)
+      .add_property("profile", &BehaviourIntegrationResult::profile);
 
   // wrapping std::vector<BehaviourIntegrationResult>
   mgis::python::initializeVectorConverter<
@@ -214,6 +261,10 @@ void declareIntegrate() {
                     "-  0: all integrations succeeded but results are\n "
                     "      unreliable for at least one Gauss point\n"
                     "-  1: integration succeeded and results are reliable.")
+      .add_property("failures",
+                    &MultiThreadedBehaviourIntegrationResult::failures)
+      .add_property("profile",
+                    &MultiThreadedBehaviourIntegrationResult::profile)
       .add_property("results",
                     &MultiThreadedBehaviourIntegrationResult::results);
 
@@ -13,7 +13,9 @@
  */
 
 #include <boost/python/def.hpp>
+#include <boost/python/enum.hpp>
 #include <boost/python/class.hpp>
+#include "MGIS/ThreadPool.hxx"
 #include "MGIS/Python/NumPySupport.hxx"
 #include "MGIS/Behaviour/Behaviour.hxx"
 #include "MGIS/Behaviour/MaterialDataManager.hxx"
@@ -45,6 +47,10 @@ static void MaterialDataManager_useExternalArrayOfSpeedOfSounds(
 
 static boost::python::object MaterialDataManager_getK(
     mgis::behaviour::MaterialDataManager& d) {
+  if (d.tangent_operator_storage !=
+      mgis::behaviour::TangentOperatorStorage::FULL_BLOCKS) {
+    return mgis::python::wrapInNumPyArray(d.K, d.K_stride);
+  }
   if (d.b.to_blocks.size() == 1u) {
     const auto nl =
         getVariableSize(d.b.to_blocks.front().second, d.b.hypothesis);
@@ -61,14 +67,26 @@ void declareMaterialDataManager() {
   using mgis::behaviour::Behaviour;
   using mgis::behaviour::MaterialDataManager;
   using mgis::behaviour::MaterialDataManagerInitializer;
+  using mgis::behaviour::TangentOperatorStorage;
   // pointers to free functions to disambiguate the function resolution
   void (*ptr_update)(MaterialDataManager&) = &mgis::behaviour::update;
   void (*ptr_revert)(MaterialDataManager&) = &mgis::behaviour::revert;
+  void (*ptr_update2)(mgis::ThreadPool&, MaterialDataManager&) =
+      &mgis::behaviour::update;
+  void (*ptr_revert2)(mgis::ThreadPool&, MaterialDataManager&) =
+      &mgis::behaviour::revert;
+  // exporting the TangentOperatorStorage enum
+  boost::python::enum_<TangentOperatorStorage>("TangentOperatorStorage")
+      .value("FULL_BLOCKS", TangentOperatorStorage::FULL_BLOCKS)
+      .value("PACKED_SYMMETRIC_BLOCKS",
+             TangentOperatorStorage::PACKED_SYMMETRIC_BLOCKS);
   // exporting the MaterialDataManager class
   boost::python::class_<MaterialDataManagerInitializer>(
       "MaterialDataManagerInitializer")
       .add_property("s0", &MaterialDataManagerInitializer::s0)
       .add_property("s1", &MaterialDataManagerInitializer::s1)
+      .add_property("tangent_operator_storage",
+                    &MaterialDataManagerInitializer::tangent_operator_storage)
       .def("bindTangentOperator",
            &MaterialDataManagerInitializer_bindTangentOperator,
            "use the given array to store the tangent operator blocks")
@@ -103,6 +121,9 @@ void declareMaterialDataManager() {
            &MaterialDataManager::releaseArrayOfSpeedOfSounds,
            "release the array of speed of sounds")
       .def_readonly("n", &MaterialDataManager::n)
+      .def_readonly("tangent_operator_storage",
+                    &MaterialDataManager::tangent_operator_storage)
+      .def_readonly("K_stride", &MaterialDataManager::K_stride)
       .def_readonly("number_of_integration_points", &MaterialDataManager::n)
       .add_property("s0", &MaterialDataManager::s0)
       .add_property("s1", &MaterialDataManager::s1)
@@ -112,5 +133,7 @@ void declareMaterialDataManager() {
   // free functions
   boost::python::def("update", ptr_update);
   boost::python::def("revert", ptr_revert);
+  boost::python::def("update", ptr_update2);
+  boost::python::def("revert", ptr_revert2);
 
 }  // end of declareMaterialDataManager
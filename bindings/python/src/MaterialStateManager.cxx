@@ -50,19 +50,35 @@ static void MaterialStateManagerInitializer_bindDissipatedEnergies(
   i.dissipated_energies = mgis::python::mgis_convert_to_span(K);
 }  // end of MaterialStateManagerInitializer_bindDissipatedEnergies
 
+static void MaterialStateManager_checkDoublePrecision(
+    const mgis::behaviour::MaterialStateManager& s, const char* const n) {
+  if (s.precision !=
+      mgis::behaviour::StateStoragePrecision::DOUBLE_PRECISION) {
+    mgis::raise(std::string(n) +
+                ": the values are stored in single precision and can't be "
+                "exposed as a numpy array");
+  }
+}  // end of MaterialStateManager_checkDoublePrecision
+
 static boost::python::object MaterialStateManager_getGradients(
     mgis::behaviour::MaterialStateManager& s) {
+  MaterialStateManager_checkDoublePrecision(
+      s, "MaterialStateManager_getGradients");
   return mgis::python::wrapInNumPyArray(s.gradients, s.gradients_stride);
 }  // end of MaterialStateManager_getGradients
 
 static boost::python::object MaterialStateManager_getThermodynamicForces(
     mgis::behaviour::MaterialStateManager& s) {
+  MaterialStateManager_checkDoublePrecision(
+      s, "MaterialStateManager_getThermodynamicForces");
   return mgis::python::wrapInNumPyArray(s.thermodynamic_forces,
                                         s.thermodynamic_forces_stride);
 }  // end of MaterialStateManager_getThermodynamicForces
 
 static boost::python::object MaterialStateManager_getInternalStateVariables(
     mgis::behaviour::MaterialStateManager& s) {
+  MaterialStateManager_checkDoublePrecision(
+      s, "MaterialStateManager_getInternalStateVariables");
   return mgis::python::wrapInNumPyArray(s.internal_state_variables,
                                         s.internal_state_variables_stride);
 }  // end of MaterialStateManager_getInternalStateVariables
@@ -124,6 +140,7 @@ void declareMaterialStateManager() {
   using mgis::behaviour::Behaviour;
   using mgis::behaviour::MaterialStateManager;
   using mgis::behaviour::MaterialStateManagerInitializer;
+  using mgis::behaviour::StateStoragePrecision;
   // wrapping the MaterialStateManager::StorageMode enum
   boost::python::enum_<MaterialStateManager::StorageMode>(
       "MaterialStateManagerStorageMode")
@@ -136,6 +153,10 @@ void declareMaterialStateManager() {
              MaterialStateManager::StorageMode::EXTERNAL_STORAGE)
       .value("ExternalStorage",
              MaterialStateManager::StorageMode::EXTERNAL_STORAGE);
+  // wrapping the StateStoragePrecision enum
+  boost::python::enum_<StateStoragePrecision>("StateStoragePrecision")
+      .value("DOUBLE_PRECISION", StateStoragePrecision::DOUBLE_PRECISION)
+      .value("SINGLE_PRECISION", StateStoragePrecision::SINGLE_PRECISION);
   // wrapping the MaterialStateManagerInitializer class
   boost::python::class_<MaterialStateManagerInitializer>(
       "MaterialStateManagerInitializer")
@@ -152,7 +173,10 @@ void declareMaterialStateManager() {
            "use the given array to store the stored energies")
       .def("bindDissipatedEnergies",
            &MaterialStateManagerInitializer_bindDissipatedEnergies,
-           "use the given array to store the dissipated energies");
+           "use the given array to store the dissipated energies")
+      .def_readwrite("precision", &MaterialStateManagerInitializer::precision,
+                     "precision used to store the gradients, the "
+                     "thermodynamic forces and the internal state variables");
   // wrapping the MaterialStateManager class
   boost::python::class_<MaterialStateManager, boost::noncopyable>(
       "MaterialStateManager",
@@ -161,6 +185,7 @@ void declareMaterialStateManager() {
                                const MaterialStateManagerInitializer&>())
       .def_readonly("n", &MaterialStateManager::n)
       .def_readonly("number_of_integration_points", &MaterialStateManager::n)
+      .def_readonly("precision", &MaterialStateManager::precision)
       .add_property("gradients", &MaterialStateManager_getGradients)
       .def_readonly("gradients_stride", &MaterialStateManager::gradients_stride)
       .add_property("thermodynamic_forces",
@@ -12,10 +12,64 @@
  *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
  */
 
+#include <boost/python/list.hpp>
+#include <boost/python/enum.hpp>
 #include <boost/python/class.hpp>
+#include <boost/python/extract.hpp>
 #include "MGIS/ThreadPool.hxx"
 
+static boost::python::list ThreadPoolOptions_getCPUs(
+    const mgis::ThreadPoolOptions& o) {
+  boost::python::list l;
+  for (const auto cpu : o.cpus) {
+    l.append(cpu);
+  }
+  return l;
+}  // end of ThreadPoolOptions_getCPUs
+
+static void ThreadPoolOptions_setCPUs(mgis::ThreadPoolOptions& o,
+                                      const boost::python::list& l) {
+  o.cpus.clear();
+  for (boost::python::ssize_t i = 0; i != boost::python::len(l); ++i) {
+    o.cpus.push_back(boost::python::extract<mgis::size_type>(l[i]));
+  }
+}  // end of ThreadPoolOptions_setCPUs
+
+static boost::python::object ThreadPool_getWorkerNUMANode(
+    const mgis::ThreadPool& p, const mgis::size_type i) {
+  const auto n = p.getWorkerNUMANode(i);
+  if (!n.has_value()) {
+    return boost::python::object();
+  }
+  return boost::python::object(*n);
+}  // end of ThreadPool_getWorkerNUMANode
+
+static boost::python::object ThreadPool_getWorkerCPU(
+    const mgis::ThreadPool& p, const mgis::size_type i) {
+  const auto cpu = p.getWorkerCPU(i);
+  if (!cpu.has_value()) {
+    return boost::python::object();
+  }
+  return boost::python::object(*cpu);
+}  // end of ThreadPool_getWorkerCPU
+
 void declareThreadPool() {
+  using mgis::ThreadAffinityPolicy;
+  using mgis::ThreadPoolOptions;
+  boost::python::enum_<ThreadAffinityPolicy>("ThreadAffinityPolicy")
+      .value("NO_AFFINITY", ThreadAffinityPolicy::NO_AFFINITY)
+      .value("ROUND_ROBIN", ThreadAffinityPolicy::ROUND_ROBIN)
+      .value("CPU_LIST", ThreadAffinityPolicy::CPU_LIST);
+  boost::python::class_<ThreadPoolOptions>("ThreadPoolOptions")
+      .def_readwrite("affinity", &ThreadPoolOptions::affinity)
+      .add_property("cpus", &ThreadPoolOptions_getCPUs,
+                    &ThreadPoolOptions_setCPUs);
   boost::python::class_<mgis::ThreadPool, boost::noncopyable>(
-      "ThreadPool", boost::python::init<mgis::size_type>());
+      "ThreadPool", boost::python::init<mgis::size_type>())
+      .def(boost::python::init<mgis::size_type, const ThreadPoolOptions&>())
+      .def("getNumberOfThreads", &mgis::ThreadPool::getNumberOfThreads)
+      .def("getWorkerCPU", &ThreadPool_getWorkerCPU,
+           "return the processor to which the given worker is bound, if any")
+      .def("getWorkerNUMANode", &ThreadPool_getWorkerNUMANode,
+           "return the NUMA node of the given worker, if known");
 }  // end of declareThreadPool
\ No newline at end of file
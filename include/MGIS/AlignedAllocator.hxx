@@ -0,0 +1,123 @@
+/*!
+ * \file   include/MGIS/AlignedAllocator.hxx
+ * \brief  This file declares an allocator returning aligned memory which is
+ * not initialized by the standard containers.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_ALIGNEDALLOCATOR_HXX
+#define LIB_MGIS_ALIGNEDALLOCATOR_HXX
+
+#include <new>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+#include "MGIS/Config.hxx"
+
+namespace mgis {
+
+  //! \brief alignment of the memory blocks returned by `AlignedAllocator`
+  inline constexpr std::size_t cache_line_size = 64;
+  /*!
+   * \brief alignment of the memory blocks whose size exceeds this value.
+   * On `Linux`, the kernel is advised to back those blocks by transparent
+   * huge pages.
+   */
+  inline constexpr std::size_t huge_page_size = 2 * 1024 * 1024;
+
+  /*!
+   * \brief allocate a memory block aligned on a cache line, or on a huge
+   * page if its size is greater than `huge_page_size`.
+   * \return a pointer to the allocated memory
+   * \param[in] s: size of the memory block, in bytes
+   * \note `std::bad_alloc` is thrown on failure
+   */
+  MGIS_EXPORT void* allocateAlignedMemory(const std::size_t);
+  /*!
+   * \brief free a memory block allocated by `allocateAlignedMemory`
+   * \param[in] p: pointer to the memory block
+   */
+  MGIS_EXPORT void freeAlignedMemory(void* const) noexcept;
+
+  /*!
+   * \brief an allocator returning aligned memory (see
+   * `allocateAlignedMemory`).
+   *
+   * Contrary to `std::allocator`, the elements are default-initialized
+   * rather than value-initialized when a container is resized, i.e.
+   * floating-point values are left uninitialized. This allows the memory to
+   * be initialized later by the threads which will use it, so that, with
+   * the first-touch policy of most operating systems, the memory pages are
+   * allocated on their NUMA nodes.
+   */
+  template <typename ValueType>
+  struct AlignedAllocator {
+    //! \brief type of the allocated values
+    using value_type = ValueType;
+    //! \brief default constructor
+    AlignedAllocator() noexcept = default;
+    //! \brief converting constructor
+    template <typename OtherValueType>
+    AlignedAllocator(const AlignedAllocator<OtherValueType>&) noexcept {}
+    /*!
+     * \return a pointer to an uninitialized array
+     * \param[in] n: number of values
+     */
+    ValueType* allocate(const std::size_t n) {
+      return static_cast<ValueType*>(
+          allocateAlignedMemory(n * sizeof(ValueType)));
+    }  // end of allocate
+    /*!
+     * \brief free an array allocated by the `allocate` method
+     * \param[in] p: pointer to the array
+     */
+    void deallocate(ValueType* const p, const std::size_t) noexcept {
+      freeAlignedMemory(p);
+    }  // end of deallocate
+    /*!
+     * \brief default-initialize a value
+     * \param[in] p: pointer to the value
+     */
+    template <typename OtherValueType>
+    void construct(OtherValueType* const p) noexcept(
+        std::is_nothrow_default_constructible_v<OtherValueType>) {
+      ::new (static_cast<void*>(p)) OtherValueType;
+    }  // end of construct
+    /*!
+     * \brief construct a value from the given arguments
+     * \param[in] p: pointer to the value
+     * \param[in] args: arguments
+     */
+    template <typename OtherValueType, typename... Arguments>
+    void construct(OtherValueType* const p, Arguments&&... args) noexcept(
+        std::is_nothrow_constructible_v<OtherValueType, Arguments...>) {
+      ::new (static_cast<void*>(p))
+          OtherValueType(std::forward<Arguments>(args)...);
+    }  // end of construct
+  };   // end of struct AlignedAllocator
+
+  //! \brief all aligned allocators are interchangeable
+  template <typename ValueType, typename OtherValueType>
+  constexpr bool operator==(const AlignedAllocator<ValueType>&,
+                            const AlignedAllocator<OtherValueType>&) noexcept {
+    return true;
+  }  // end of operator==
+
+  //! \brief all aligned allocators are interchangeable
+  template <typename ValueType, typename OtherValueType>
+  constexpr bool operator!=(const AlignedAllocator<ValueType>&,
+                            const AlignedAllocator<OtherValueType>&) noexcept {
+    return false;
+  }  // end of operator!=
+
+}  // end of namespace mgis
+
+#endif /* LIB_MGIS_ALIGNEDALLOCATOR_HXX */
@@ -18,14 +18,23 @@
 #include <map>
 #include <iosfwd>
 #include <vector>
+#include <optional>
 #include "MGIS/Config.hxx"
 #include "MGIS/Span.hxx"
+#include "MGIS/ThreadedTaskResult.hxx"
 #include "MGIS/Behaviour/Hypothesis.hxx"
 #include "MGIS/Behaviour/Variable.hxx"
 #include "MGIS/Behaviour/RotationMatrix.hxx"
 #include "MGIS/Behaviour/FiniteStrainBehaviourOptions.hxx"
 #include "MGIS/Behaviour/BehaviourFctPtr.hxx"
 
+namespace mgis {
+
+  // forward declaration
+  struct ThreadPool;
+
+}  // namespace mgis
+
 namespace mgis::behaviour {
 
   //! \brief structure describing an initialize function of a behaviour
@@ -195,8 +204,29 @@ namespace mgis::behaviour {
      *   stress with respect to the deformation gradient is returned
      */
     std::vector<mgis::real> options;
+    /*!
+     * \brief indexes of the gradients, thermodynamic forces, material
+     * properties, internal state variables and external state variables.
+     *
+     * Those indexes are built by the `load` functions and used by the
+     * functions accessing a variable by its name.
+     *
+     * \note the `updateVariablesIndexes` function must be called if the
+     * lists of variables are modified.
+     */
+    VariablesIndex gradients_index;
+    VariablesIndex thermodynamic_forces_index;
+    VariablesIndex mps_index;
+    VariablesIndex isvs_index;
+    VariablesIndex esvs_index;
   };  // end of struct Behaviour
 
+  /*!
+   * \brief build the indexes of the variables of a behaviour
+   * \param[in,out] b: behaviour
+   */
+  MGIS_EXPORT void updateVariablesIndexes(Behaviour &);
+
   /*!
    * \return if the given behaviour is a standard finite strain behaviour,
    * i.e. is a finite strain behaviour using the standard finite strain
@@ -220,6 +250,10 @@ namespace mgis::behaviour {
    * \return the behaviour description
    * \note: use of `std::string` rather than `mgis::string_view` is
    * meaningfull here
+   * \note the descriptions of the behaviours already loaded are cached, so
+   * that loading the same behaviour again only copies the cached
+   * description.
+   * \note this function can be called concurrently from many threads.
    */
   MGIS_EXPORT Behaviour load(const std::string &,
                              const std::string &,
@@ -239,11 +273,62 @@ namespace mgis::behaviour {
    * \return the behaviour description
    * \note: use of `std::string` rather than `mgis::string_view` is
    * meaningfull here
+   * \note the descriptions of the behaviours already loaded are cached. The
+   * options are part of the key of the cache.
    */
   MGIS_EXPORT Behaviour load(const FiniteStrainBehaviourOptions &,
                              const std::string &,
                              const std::string &,
                              const Hypothesis);
+
+  //! \brief structure describing a behaviour to be loaded
+  struct BehaviourLoadRequest {
+    //! \brief library name
+    std::string library;
+    //! \brief behaviour name
+    std::string behaviour;
+    //! \brief modelling hypothesis
+    Hypothesis hypothesis;
+    /*!
+     * \brief finite strain options. Those options must be given for finite
+     * strain behaviours.
+     */
+    std::optional<FiniteStrainBehaviourOptions> options;
+  };  // end of struct BehaviourLoadRequest
+
+  /*!
+   * \brief load the descriptions of many behaviours using the threads of a
+   * thread pool.
+   *
+   * Each library is opened only once, and the behaviours requested more
+   * than once are only loaded once.
+   *
+   * \param[in,out] p: thread pool
+   * \param[in] requests: behaviours to be loaded
+   * \return the behaviours' descriptions, in the order of the requests. If
+   * a behaviour could not be loaded, the associated result holds the
+   * exception thrown.
+   */
+  MGIS_EXPORT std::vector<ThreadedTaskResult<Behaviour>> load(
+      mgis::ThreadPool &, const std::vector<BehaviourLoadRequest> &);
+  /*!
+   * \return the number of descriptions of behaviours cached by the `load`
+   * functions
+   */
+  MGIS_EXPORT mgis::size_type getBehaviourCacheSize();
+  /*!
+   * \brief clear the cache of the descriptions of the behaviours used by the
+   * `load` functions.
+   *
+   * This cache is never cleared otherwise. Long-running processes may use
+   * this function to release the memory it uses, or to make sure that the
+   * following calls to the `load` functions build the descriptions again,
+   * for instance after a library has been rebuilt.
+   *
+   * \note the libraries are not unloaded by this function.
+   * \note this function can be called concurrently from many threads.
+   */
+  MGIS_EXPORT void clearBehaviourCache();
   /*!
    * \return the size of an array able to contain all the values of the
    * tangent operator
@@ -480,6 +565,94 @@ namespace mgis::behaviour {
                                                const Behaviour &,
                                                const mgis::span<const real> &,
                                                const RotationMatrix3D &);
+  /*!
+   * \brief rotate an array of gradients from the global frame to the material
+   * frame using the threads of a thread pool.
+   * \param[in,out] p: thread pool
+   * \param[out,in] g: gradients
+   * \param[in] b: behaviour description
+   * \param[in] r: rotation matrix from the global frame to the material
+   * frame.
+   * \note the rotation matrix argument can be given as a:
+   * - an array of size 9 which is interpreted as a 3x3 rotation matrix.
+   * - an array of size 9*n where n is the number of integration
+   *   points which is interpreted as a field of 3x3 rotation matrix.
+   */
+  MGIS_EXPORT void rotateGradients(mgis::ThreadPool &,
+                                   mgis::span<real>,
+                                   const Behaviour &,
+                                   const mgis::span<const real> &);
+  /*!
+   * \brief rotate an array of gradients from the global frame to the material
+   * frame using the threads of a thread pool.
+   * \param[in,out] p: thread pool
+   * \param[out] mg: array of gradients in the material frame
+   * \param[in] b: behaviour description
+   * \param[out] gg: array of gradients in the global frame
+   * \param[in] r: rotation matrix from the global frame to the material
+   * frame.
+   */
+  MGIS_EXPORT void rotateGradients(mgis::ThreadPool &,
+                                   mgis::span<real>,
+                                   const Behaviour &,
+                                   const mgis::span<const real> &,
+                                   const mgis::span<const real> &);
+  /*!
+   * \brief rotate an array of thermodynamics forces from the material frame
+   * to the global frame using the threads of a thread pool.
+   * \param[in,out] p: thread pool
+   * \param[out,in] tf: thermodynamics forces
+   * \param[in] b: behaviour description
+   * \param[in] r: rotation matrix from the global frame to the material
+   * frame.
+   */
+  MGIS_EXPORT void rotateThermodynamicForces(mgis::ThreadPool &,
+                                             mgis::span<real>,
+                                             const Behaviour &,
+                                             const mgis::span<const real> &);
+  /*!
+   * \brief rotate an array of thermodynamics forces from the material frame
+   * to the global frame using the threads of a thread pool.
+   * \param[in,out] p: thread pool
+   * \param[out] gtf: thermodynamics forces in the global frame
+   * \param[in] b: behaviour description
+   * \param[in] mtf: thermodynamics forces in the material frame
+   * \param[in] r: rotation matrix from the global frame to the material
+   * frame.
+   */
+  MGIS_EXPORT void rotateThermodynamicForces(mgis::ThreadPool &,
+                                             mgis::span<real>,
+                                             const Behaviour &,
+                                             const mgis::span<const real> &,
+                                             const mgis::span<const real> &);
+  /*!
+   * \brief rotate an array of tangent operator blocks from the material frame
+   * to the global frame using the threads of a thread pool.
+   * \param[in,out] p: thread pool
+   * \param[out,in] K: tangent operator blocks
+   * \param[in] b: behaviour description
+   * \param[in] r: rotation matrix from the global frame to the material
+   * frame.
+   */
+  MGIS_EXPORT void rotateTangentOperatorBlocks(mgis::ThreadPool &,
+                                               mgis::span<real>,
+                                               const Behaviour &,
+                                               const mgis::span<const real> &);
+  /*!
+   * \brief rotate an array of tangent operator blocks from the material frame
+   * to the global frame using the threads of a thread pool.
+   * \param[in,out] p: thread pool
+   * \param[out] gK: tangent operator blocks in the global frame
+   * \param[in] b: behaviour description
+   * \param[in] mK: tangent operator blocks in the material frame
+   * \param[in] r: rotation matrix from the global frame to the material
+   * frame.
+   */
+  MGIS_EXPORT void rotateTangentOperatorBlocks(mgis::ThreadPool &,
+                                               mgis::span<real>,
+                                               const Behaviour &,
+                                               const mgis::span<const real> &,
+                                               const mgis::span<const real> &);
   /*!
    * \brief set the value of a parameter
    * \param[in] b: behaviour description
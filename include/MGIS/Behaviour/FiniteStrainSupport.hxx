@@ -18,6 +18,13 @@
 #include "MGIS/Config.hxx"
 #include "MGIS/Span.hxx"
 
+namespace mgis {
+
+  // forward declaration
+  struct ThreadPool;
+
+}  // namespace mgis
+
 namespace mgis::behaviour {
 
   // forward declaration
@@ -80,6 +87,29 @@ namespace mgis::behaviour {
       mgis::span<real>&,
       const MaterialDataManager&,
       const FiniteStrainTangentOperator);
+  /*!
+   * \brief convert the stress using the threads of a thread pool
+   * \param[in,out] p: thread pool
+   * \param[out] s: new stress
+   * \param[in] m: material data manager
+   * \param[in] t: expected finite strain stress type
+   */
+  MGIS_EXPORT void convertFiniteStrainStress(mgis::ThreadPool&,
+                                             mgis::span<real>&,
+                                             const MaterialDataManager&,
+                                             const FiniteStrainStress);
+  /*!
+   * \brief convert the tangent operator using the threads of a thread pool
+   * \param[in,out] p: thread pool
+   * \param[out] K: new tangent operator
+   * \param[in] m: material data manager
+   * \param[in] t: expected finite strain operator type
+   */
+  MGIS_EXPORT void convertFiniteStrainTangentOperator(
+      mgis::ThreadPool&,
+      mgis::span<real>&,
+      const MaterialDataManager&,
+      const FiniteStrainTangentOperator);
   /*!
    * \param[out] s: new stress
    * \param[in] d: behaviour data
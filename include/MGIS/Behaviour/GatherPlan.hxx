@@ -0,0 +1,125 @@
+/*!
+ * \file   include/MGIS/Behaviour/GatherPlan.hxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_BEHAVIOUR_GATHERPLAN_HXX
+#define LIB_MGIS_BEHAVIOUR_GATHERPLAN_HXX
+
+#include <tuple>
+#include <vector>
+#include "MGIS/Config.hxx"
+
+namespace mgis::behaviour {
+
+  // forward declaration
+  struct MaterialDataManager;
+
+  /*!
+   * \brief description of how the values of a material property or an
+   * external state variable are gathered for one integration point.
+   */
+  struct GatheringOperation {
+    //! \brief offset of the variable in the gathered array
+    size_type offset;
+    //! \brief size of the variable
+    size_type size;
+    /*!
+     * \brief pointer to the values of the variable. The values associated
+     * with the `i`th integration point start at `values + i * stride`.
+     */
+    const real* values;
+    //! \brief stride. A null stride denotes a uniform variable.
+    size_type stride;
+  };  // end of struct GatheringOperation
+
+  /*!
+   * \brief description of how the values of the material properties (or the
+   * external state variables) are gathered for one integration point.
+   */
+  struct VariablesGatherPlan {
+    /*!
+     * \brief operations associated with the uniform variables. Those
+     * operations only need to be performed once for a range of integration
+     * points.
+     */
+    std::vector<GatheringOperation> uniform_variables;
+    /*!
+     * \brief operations associated with the spatially variable variables.
+     * Those operations must be performed for each integration point.
+     */
+    std::vector<GatheringOperation> variable_variables;
+    /*!
+     * \brief if not null, the values for the `i`th integration point are
+     * directly available at `direct_values + i * direct_stride`, i.e. no copy
+     * is required. This is the case when only one spatially variable variable
+     * is defined.
+     */
+    const real* direct_values = nullptr;
+    //! \brief stride associated with `direct_values`
+    size_type direct_stride = 0;
+  };  // end of struct VariablesGatherPlan
+
+  /*!
+   * \brief a structure describing how the material properties and the
+   * external state variables of a material data manager are gathered for one
+   * integration point.
+   *
+   * A gather plan refers to the memory of the field holders of the material
+   * state managers. It is only valid as long as the layout of those field
+   * holders is unchanged, which is checked by the `isGatherPlanValid`
+   * function.
+   */
+  struct MGIS_EXPORT GatherPlan {
+    /*!
+     * \brief a simple alias describing the layout of a field holder: address
+     * of the field holder, index of the active alternative, address and size
+     * of the values.
+     */
+    using FieldHolderLayout =
+        std::tuple<const void*, std::size_t, const real*, size_type>;
+    //! \brief material properties at the beginning of the time step
+    VariablesGatherPlan mps0;
+    //! \brief material properties at the end of the time step
+    VariablesGatherPlan mps1;
+    //! \brief external state variables at the beginning of the time step
+    VariablesGatherPlan esvs0;
+    //! \brief external state variables at the end of the time step
+    VariablesGatherPlan esvs1;
+    //! \brief layout version of the state at the beginning of the time step
+    size_type s0_layout_version = 0;
+    //! \brief layout version of the state at the end of the time step
+    size_type s1_layout_version = 0;
+    /*!
+     * \brief signature of the layout of the field holders, used to detect
+     * direct modifications of the field holders which did not update the
+     * layout versions.
+     */
+    std::vector<FieldHolderLayout> layout_signature;
+  };  // end of struct GatherPlan
+
+  /*!
+   * \brief build the gather plan associated with a material data manager
+   * \param[in] m: material data manager
+   */
+  MGIS_EXPORT GatherPlan buildGatherPlan(const MaterialDataManager&);
+  /*!
+   * \return if the given gather plan is still valid
+   * \param[in] p: gather plan
+   * \param[in] m: material data manager
+   */
+  MGIS_EXPORT bool isGatherPlanValid(const GatherPlan&,
+                                     const MaterialDataManager&);
+
+}  // end of namespace mgis::behaviour
+
+#endif /* LIB_MGIS_BEHAVIOUR_GATHERPLAN_HXX */
@@ -14,11 +14,20 @@
 #ifndef LIB_MGIS_BEHAVIOUR_INTEGRATE_HXX
 #define LIB_MGIS_BEHAVIOUR_INTEGRATE_HXX
 
+#include <array>
+#include <iosfwd>
 #include <limits>
+#include <memory>
+#include <string>
 #include <thread>
+#include <future>
 #include <vector>
+#include <utility>
+#include <functional>
 #include "MGIS/Config.hxx"
 #include "MGIS/Span.hxx"
+#include "MGIS/ThreadedTaskResult.hxx"
+#include "MGIS/SchedulingOptions.hxx"
 #include "MGIS/Behaviour/BehaviourDataView.hxx"
 
 namespace mgis {
@@ -28,6 +37,13 @@ namespace mgis {
 
 }  // namespace mgis
 
+namespace mgis::behaviour::internals {
+
+  // forward declaration
+  struct MultiThreadedExecutionState;
+
+}  // end of namespace mgis::behaviour::internals
+
 namespace mgis::behaviour {
 
   // forward declaration
@@ -49,6 +65,23 @@ namespace mgis::behaviour {
     INTEGRATION_CONSISTENT_TANGENT_OPERATOR = 4
   };  // end of enum IntegrationType
 
+  /*!
+   * \brief description of a post-processing executed by the `integrate`
+   * functions right after the integration of each integration point (see
+   * the `postprocessings` member of the `BehaviourIntegrationOptions`
+   * structure).
+   */
+  struct BehaviourIntegrationPostProcessing {
+    //! \brief name of the post-processing
+    std::string name;
+    /*!
+     * \brief post-processing results, given for all integration points. The
+     * size of this array must be equal to the number of integration points
+     * times the size of the outputs of the post-processing.
+     */
+    mgis::span<mgis::real> outputs;
+  };  // end of BehaviourIntegrationPostProcessing
+
   /*!
    * \brief structure defining various option
    */
@@ -58,8 +91,139 @@ namespace mgis::behaviour {
         IntegrationType::INTEGRATION_CONSISTENT_TANGENT_OPERATOR;
     //! \brief if true, the speed of sound shall be computed
     bool compute_speed_of_sound = false;
+    /*!
+     * \brief options describing how the integration points are distributed
+     * between threads. Those options are only used by the versions of the
+     * `integrate` function taking a thread pool as argument.
+     */
+    mgis::SchedulingOptions scheduling;
+    /*!
+     * \brief maximum number of local sub-steps. If greater than one, the
+     * integration of an integration point which failed, or which reported a
+     * time step increase factor lower than one, is retried by splitting the
+     * time step in local sub-steps. The gradients, material properties and
+     * external state variables are linearly interpolated over the time step.
+     * The size of the sub-steps is driven by the time step increase factors
+     * proposed by the behaviour.
+     *
+     * \note local sub-stepping is not used for prediction operators.
+     */
+    mgis::size_type maximum_number_of_substeps = 0;
+    /*!
+     * \brief if true, the integration stops at the first integration point
+     * for which the integration failed. Otherwise, all the integration points
+     * are treated and the failures are reported in the `failures` member of
+     * the integration result.
+     */
+    bool stop_on_failure = true;
+    /*!
+     * \brief if true, the `integrate` functions collect statistics about
+     * the integration (see the `BehaviourIntegrationProfile` structure).
+     * Those statistics are reported in the `profile` member of the
+     * integration result.
+     *
+     * \note collecting statistics requires to measure the time spent in
+     * each integration point, which has a small cost.
+     */
+    bool profile = false;
+    /*!
+     * \brief post-processings executed right after the integration of each
+     * integration point, while its data are still in cache. This avoids a
+     * second pass over the integration points with the
+     * `executePostProcessing` functions.
+     *
+     * \note the post-processings are only executed for the integration
+     * points for which the integration succeeded. If a post-processing fails,
+     * the integration is considered to have failed at this integration
+     * point.
+     * \note the post-processings are not executed for prediction operators.
+     */
+    std::vector<BehaviourIntegrationPostProcessing> postprocessings;
   };  // end of BehaviourIntegrationOptions
 
+  /*!
+   * \brief statistics collected during the integration of a set of
+   * integration points (see the `profile` member of the
+   * `BehaviourIntegrationOptions` structure).
+   *
+   * Those statistics allow to determine if the time spent in an integration
+   * is dominated by the overhead of `MGIS` (gathering the material
+   * properties and the external state variables, building the views of the
+   * integration points) or by the behaviour itself.
+   */
+  struct BehaviourIntegrationProfile {
+    //! \brief number of bins of the histogram of the time step factors
+    static constexpr mgis::size_type rdt_histogram_size = 7;
+    /*!
+     * \brief upper bounds of the bins of the histogram of the time step
+     * increase factors. The last bin gathers the factors greater than the
+     * last bound.
+     */
+    static constexpr std::array<mgis::real, rdt_histogram_size - 1>
+        rdt_histogram_bounds = {0.1, 0.5, 1, 1.2, 2, 5};
+    //! \brief number of treated integration points
+    mgis::size_type number_of_integration_points = 0;
+    /*!
+     * \brief number of integration points for which the behaviour reported
+     * unreliable results, i.e. returned `0`.
+     */
+    mgis::size_type number_of_unreliable_results = 0;
+    //! \brief number of integration points for which the integration failed
+    mgis::size_type number_of_failures = 0;
+    /*!
+     * \brief wall clock time, in seconds, spent in the treatment of the
+     * integration points. For multi-threaded integrations, this time is
+     * summed over the threads.
+     */
+    mgis::real wall_time = 0;
+    /*!
+     * \brief time, in seconds, spent in gathering the material properties
+     * and the external state variables and in building the views of the
+     * integration points.
+     */
+    mgis::real data_access_time = 0;
+    /*!
+     * \brief time, in seconds, spent in the behaviour, including the local
+     * sub-steps, if any.
+     */
+    mgis::real behaviour_time = 0;
+    /*!
+     * \brief histogram of the time step increase factors proposed by the
+     * behaviour (see the `rdt_histogram_bounds` member).
+     */
+    std::array<mgis::size_type, rdt_histogram_size> rdt_histogram = {};
+  };  // end of struct BehaviourIntegrationProfile
+
+  /*!
+   * \return the number of integration points treated per second of wall
+   * clock time, or zero if no time was measured.
+   * \param[in] p: profile
+   */
+  MGIS_EXPORT mgis::real getNumberOfIntegrationPointsPerSecond(
+      const BehaviourIntegrationProfile&);
+  /*!
+   * \brief print a profile using the markdown format
+   * \param[in] os: output stream
+   * \param[in] p: profile
+   * \param[in] l: title level
+   */
+  MGIS_EXPORT void print_markdown(std::ostream&,
+                                  const BehaviourIntegrationProfile&,
+                                  const mgis::size_type);
+
+  /*!
+   * \brief structure describing a failure of the behaviour at one
+   * integration point.
+   */
+  struct BehaviourIntegrationFailure {
+    //! \brief integration point
+    mgis::size_type n;
+    //! \brief exit status reported by the behaviour
+    int exit_status;
+    //! \brief error message
+    std::string error_message;
+  };  // end of struct BehaviourIntegrationFailure
+
   /*!
    * \brief structure in charge of reporting the result of a behaviour
    * integration.
@@ -95,6 +259,34 @@ namespace mgis::behaviour {
     mgis::size_type n = std::numeric_limits<mgis::size_type>::max();
     //! \brief error message, if any
     std::string error_message;
+    /*!
+     * \brief list of the integration points for which local sub-stepping was
+     * used, associated with the number of successful sub-steps. This list is
+     * sorted by integration point. A null number of sub-steps denotes that
+     * the local sub-stepping failed.
+     *
+     * \note this list is empty unless local sub-stepping is enabled (see the
+     * `maximum_number_of_substeps` member of the
+     * `BehaviourIntegrationOptions` structure).
+     */
+    std::vector<std::pair<mgis::size_type, mgis::size_type>>
+        number_of_substeps;
+    /*!
+     * \brief list of the integration points for which the integration
+     * failed, sorted by integration point. Unless the `stop_on_failure`
+     * member of the `BehaviourIntegrationOptions` structure is false, this
+     * list contains at most one failure.
+     *
+     * \note if the integration failed, the `n` and `error_message` members
+     * refer to the first failure of this list.
+     */
+    std::vector<BehaviourIntegrationFailure> failures;
+    /*!
+     * \brief statistics about the integration. Those statistics are only
+     * collected if the `profile` member of the `BehaviourIntegrationOptions`
+     * structure is true.
+     */
+    BehaviourIntegrationProfile profile;
   };  // end of struct BehaviourIntegrationResult
 
   /*!
@@ -127,9 +319,95 @@ namespace mgis::behaviour {
      * -  1: integration succeeded and results are reliable.
      */
     int exit_status = 1;
+    /*!
+     * \brief measured load imbalance, i.e. the ratio of the time spent by the
+     * slowest thread over the average time spent by the threads. A value of
+     * `1` denotes a perfect load balancing.
+     */
+    mgis::real load_imbalance = 1;
+    /*!
+     * \brief failures reported by all the threads, sorted by integration
+     * point.
+     */
+    std::vector<BehaviourIntegrationFailure> failures;
+    /*!
+     * \brief integration points for which local sub-stepping was used, sorted
+     * by integration point. See the `number_of_substeps` member of the
+     * `BehaviourIntegrationResult` structure.
+     */
+    std::vector<std::pair<mgis::size_type, mgis::size_type>>
+        number_of_substeps;
+    /*!
+     * \brief statistics gathered over all the threads. The statistics of
+     * each thread are available in the `profile` member of the results of
+     * each thread.
+     */
+    BehaviourIntegrationProfile profile;
     //! \brief integration results per threads
     std::vector<BehaviourIntegrationResult> results;
   };  // end of struct MultiThreadedBehaviourIntegrationResult
+
+  /*!
+   * \brief a function called each time the treatment of a chunk of
+   * integration points is finished. The arguments are the first index and
+   * the last index of the chunk and the result of the treatment of the
+   * chunk.
+   *
+   * \note this function is called by the threads of the thread pool and
+   * must be thread-safe. Distinct chunks do not overlap, so the callback can
+   * safely read the data associated with the integration points of the chunk
+   * (thermodynamic forces, internal state variables, tangent operator, etc.)
+   * while other chunks are being treated.
+   */
+  using BehaviourIntegrationChunkCallback = std::function<void(
+      const mgis::size_type, const mgis::size_type,
+      const BehaviourIntegrationResult&)>;
+
+  /*!
+   * \brief a handle on an integration performed asynchronously by the
+   * threads of a thread pool (see the `integrateAsynchronously` function).
+   *
+   * \note the destructor waits for the end of the integration.
+   */
+  struct MGIS_EXPORT AsynchronousBehaviourIntegration {
+    //! \brief a simple alias
+    using Task = std::future<ThreadedTaskResult<BehaviourIntegrationResult>>;
+    /*!
+     * \brief constructor
+     * \param[in] s: state shared by the tasks
+     * \param[in] t: tasks
+     *
+     * \note this constructor is meant to be called by the
+     * `integrateAsynchronously` function.
+     */
+    AsynchronousBehaviourIntegration(
+        std::shared_ptr<internals::MultiThreadedExecutionState>,
+        std::vector<Task>);
+    //! \brief move constructor
+    AsynchronousBehaviourIntegration(AsynchronousBehaviourIntegration&&);
+    //! \brief move assignement
+    AsynchronousBehaviourIntegration& operator=(
+        AsynchronousBehaviourIntegration&&);
+    //! \return true if the integration is finished
+    bool poll() const;
+    //! \brief wait for the end of the integration
+    void wait() const;
+    /*!
+     * \brief wait for the end of the integration and return its result
+     *
+     * \note this method can only be called once.
+     * \note if one task has thrown an exception, this exception is rethrown.
+     */
+    MultiThreadedBehaviourIntegrationResult get();
+    //! \brief destructor
+    ~AsynchronousBehaviourIntegration();
+
+   private:
+    //! \brief state shared by the tasks
+    std::shared_ptr<internals::MultiThreadedExecutionState> state;
+    //! \brief tasks
+    std::vector<Task> tasks;
+  };  // end of struct AsynchronousBehaviourIntegration
   /*!
    * \brief execute the given initialize function.
    * \param[in,out] d: behaviour data view
@@ -232,6 +510,175 @@ namespace mgis::behaviour {
                             MaterialDataManager&,
                             const std::string_view,
                             mgis::span<const real>);
+  /*!
+   * \brief execute the given initialize function  over all integration points
+   * using a thread pool to parallelize the integration.
+   * \param[in,out] p: thread pool
+   * \param[in,out] d: material data manager
+   * \param[in] n: name of the initialize function
+   * \param[in] s: scheduling options
+   */
+  MGIS_EXPORT MultiThreadedBehaviourIntegrationResult
+  executeInitializeFunction(ThreadPool&,
+                            MaterialDataManager&,
+                            const std::string_view,
+                            const mgis::SchedulingOptions&);
+  /*!
+   * \brief execute the given initialize function  over all integration points
+   * using a thread pool to parallelize the integration.
+   * \param[in,out] p: thread pool
+   * \param[in,out] d: material data manager
+   * \param[in] n: name of the initialize function
+   * \param[in] inputs: initialize function inputs
+   * \param[in] s: scheduling options
+   *
+   * \note the inputs can be uniform or not.
+   */
+  MGIS_EXPORT MultiThreadedBehaviourIntegrationResult
+  executeInitializeFunction(ThreadPool&,
+                            MaterialDataManager&,
+                            const std::string_view,
+                            mgis::span<const real>,
+                            const mgis::SchedulingOptions&);
+  /*!
+   * \brief execute the given initialize function over a list of integration
+   * points
+   * \param[in,out] d: material data manager
+   * \param[in] n: name of the initialize function
+   * \param[in] indices: indices of the integration points
+   * \note the list of integration points may be unsorted, but must not
+   * contain duplicates.
+   */
+  MGIS_EXPORT BehaviourIntegrationResult
+  executeInitializeFunction(MaterialDataManager&,
+                            const std::string_view,
+                            mgis::span<const size_type>);
+  /*!
+   * \brief execute the given initialize function over a list of integration
+   * points
+   * \param[in,out] d: material data manager
+   * \param[in] n: name of the initialize function
+   * \param[in] inputs: initialize function inputs
+   * \param[in] indices: indices of the integration points
+   *
+   * \note the inputs can be uniform or not. Non uniform inputs are given for
+   * all integration points.
+   * \note the list of integration points may be unsorted, but must not
+   * contain duplicates.
+   */
+  MGIS_EXPORT BehaviourIntegrationResult
+  executeInitializeFunction(MaterialDataManager&,
+                            const std::string_view,
+                            mgis::span<const real>,
+                            mgis::span<const size_type>);
+  /*!
+   * \brief execute the given initialize function over the integration points
+   * selected by a mask
+   * \param[in,out] d: material data manager
+   * \param[in] n: name of the initialize function
+   * \param[in] mask: mask. The size of the mask must be equal to the number
+   * of integration points.
+   */
+  MGIS_EXPORT BehaviourIntegrationResult
+  executeInitializeFunction(MaterialDataManager&,
+                            const std::string_view,
+                            const std::vector<bool>&);
+  /*!
+   * \brief execute the given initialize function over the integration points
+   * selected by a mask
+   * \param[in,out] d: material data manager
+   * \param[in] n: name of the initialize function
+   * \param[in] inputs: initialize function inputs
+   * \param[in] mask: mask. The size of the mask must be equal to the number
+   * of integration points.
+   *
+   * \note the inputs can be uniform or not. Non uniform inputs are given for
+   * all integration points.
+   */
+  MGIS_EXPORT BehaviourIntegrationResult
+  executeInitializeFunction(MaterialDataManager&,
+                            const std::string_view,
+                            mgis::span<const real>,
+                            const std::vector<bool>&);
+  /*!
+   * \brief execute the given initialize function over a list of integration
+   * points using a thread pool to parallelize the integration.
+   * \param[in,out] p: thread pool
+   * \param[in,out] d: material data manager
+   * \param[in] n: name of the initialize function
+   * \param[in] indices: indices of the integration points
+   * \param[in] s: scheduling options
+   *
+   * \note the list of integration points is split between the threads.
+   * \note the list of integration points may be unsorted, but must not
+   * contain duplicates.
+   */
+  MGIS_EXPORT MultiThreadedBehaviourIntegrationResult
+  executeInitializeFunction(ThreadPool&,
+                            MaterialDataManager&,
+                            const std::string_view,
+                            mgis::span<const size_type>,
+                            const mgis::SchedulingOptions&);
+  /*!
+   * \brief execute the given initialize function over a list of integration
+   * points using a thread pool to parallelize the integration.
+   * \param[in,out] p: thread pool
+   * \param[in,out] d: material data manager
+   * \param[in] n: name of the initialize function
+   * \param[in] inputs: initialize function inputs
+   * \param[in] indices: indices of the integration points
+   * \param[in] s: scheduling options
+   *
+   * \note the inputs can be uniform or not. Non uniform inputs are given for
+   * all integration points.
+   * \note the list of integration points is split between the threads.
+   * \note the list of integration points may be unsorted, but must not
+   * contain duplicates.
+   */
+  MGIS_EXPORT MultiThreadedBehaviourIntegrationResult
+  executeInitializeFunction(ThreadPool&,
+                            MaterialDataManager&,
+                            const std::string_view,
+                            mgis::span<const real>,
+                            mgis::span<const size_type>,
+                            const mgis::SchedulingOptions&);
+  /*!
+   * \brief execute the given initialize function over the integration points
+   * selected by a mask using a thread pool to parallelize the integration.
+   * \param[in,out] p: thread pool
+   * \param[in,out] d: material data manager
+   * \param[in] n: name of the initialize function
+   * \param[in] mask: mask. The size of the mask must be equal to the number
+   * of integration points.
+   * \param[in] s: scheduling options
+   */
+  MGIS_EXPORT MultiThreadedBehaviourIntegrationResult
+  executeInitializeFunction(ThreadPool&,
+                            MaterialDataManager&,
+                            const std::string_view,
+                            const std::vector<bool>&,
+                            const mgis::SchedulingOptions&);
+  /*!
+   * \brief execute the given initialize function over the integration points
+   * selected by a mask using a thread pool to parallelize the integration.
+   * \param[in,out] p: thread pool
+   * \param[in,out] d: material data manager
+   * \param[in] n: name of the initialize function
+   * \param[in] inputs: initialize function inputs
+   * \param[in] mask: mask. The size of the mask must be equal to the number
+   * of integration points.
+   * \param[in] s: scheduling options
+   *
+   * \note the inputs can be uniform or not. Non uniform inputs are given for
+   * all integration points.
+   */
+  MGIS_EXPORT MultiThreadedBehaviourIntegrationResult
+  executeInitializeFunction(ThreadPool&,
+                            MaterialDataManager&,
+                            const std::string_view,
+                            mgis::span<const real>,
+                            const std::vector<bool>&,
+                            const mgis::SchedulingOptions&);
   /*!
    * \brief integrate the behaviour. The returned value has the following
    * meaning:
@@ -305,12 +752,122 @@ namespace mgis::behaviour {
    *
    * \note if required, the memory associated with the tangent operator blocks
    * is automatically allocated.
+   * \note the distribution of the integration points between the threads is
+   * controlled by the `scheduling` member of the options. With the
+   * `WORK_STEALING` policy, the integration stops as soon as the integration
+   * failed in one chunk, i.e. some integration points may not be treated,
+   * unless the `stop_on_failure` member of the options is false.
+   * \note if the material data manager records the integration costs (see
+   * the `allocateArrayOfIntegrationCosts` method), the blocks of integration
+   * points associated with each thread are built so that their costs during
+   * the previous integration are equal.
    */
   MGIS_EXPORT MultiThreadedBehaviourIntegrationResult
   integrate(mgis::ThreadPool&,
             MaterialDataManager&,
             const BehaviourIntegrationOptions&,
             const real);
+  /*!
+   * \brief start the integration of the behaviour over all integration points
+   * using a thread pool, and return without waiting for the end of the
+   * integration.
+   * \return a handle on the integration.
+   * \param[in,out] p: thread pool
+   * \param[in,out] m: material data manager
+   * \param[in] c: description of the operation to be performed
+   * \param[in] dt: time step
+   * \param[in] f: optional function called each time the integration of a
+   * chunk of integration points is finished.
+   *
+   * \note the distribution of the integration points between the threads
+   * follows the `integrate` function. The chunks are the blocks associated
+   * with each thread with the `STATIC` policy, and the chunks of size
+   * `grain_size` with the `WORK_STEALING` policy.
+   * \note the material data manager must not be modified, nor destroyed,
+   * before the end of the integration.
+   */
+  MGIS_EXPORT AsynchronousBehaviourIntegration
+  integrateAsynchronously(mgis::ThreadPool&,
+                          MaterialDataManager&,
+                          const BehaviourIntegrationOptions&,
+                          const real,
+                          BehaviourIntegrationChunkCallback = {});
+  /*!
+   * \brief integrate the behaviour over a list of integration points.
+   * \return the result of the behaviour integration.
+   * \param[in,out] m: material data manager
+   * \param[in] c: description of the operation to be performed
+   * \param[in] dt: time step
+   * \param[in] indices: indices of the integration points
+   *
+   * \note if required, the memory associated with the tangent operator blocks
+   * is automatically allocated.
+   * \note the list of integration points may be unsorted, but must not
+   * contain duplicates.
+   */
+  MGIS_EXPORT BehaviourIntegrationResult
+  integrate(MaterialDataManager&,
+            const BehaviourIntegrationOptions&,
+            const real,
+            mgis::span<const size_type>);
+  /*!
+   * \brief integrate the behaviour over the integration points selected by a
+   * mask.
+   * \return the result of the behaviour integration.
+   * \param[in,out] m: material data manager
+   * \param[in] c: description of the operation to be performed
+   * \param[in] dt: time step
+   * \param[in] mask: mask. The size of the mask must be equal to the number
+   * of integration points.
+   *
+   * \note if required, the memory associated with the tangent operator blocks
+   * is automatically allocated.
+   */
+  MGIS_EXPORT BehaviourIntegrationResult
+  integrate(MaterialDataManager&,
+            const BehaviourIntegrationOptions&,
+            const real,
+            const std::vector<bool>&);
+  /*!
+   * \brief integrate the behaviour over a list of integration points using a
+   * thread pool to parallelize the integration.
+   * \return the result of the behaviour integration.
+   * \param[in,out] p: thread pool
+   * \param[in,out] m: material data manager
+   * \param[in] c: description of the operation to be performed
+   * \param[in] dt: time step
+   * \param[in] indices: indices of the integration points
+   *
+   * \note the list of integration points, and not the whole set of
+   * integration points, is split between the threads, following the
+   * `scheduling` member of the options. The integration costs, if recorded,
+   * are taken into account.
+   * \note the list of integration points may be unsorted, but must not
+   * contain duplicates.
+   */
+  MGIS_EXPORT MultiThreadedBehaviourIntegrationResult
+  integrate(mgis::ThreadPool&,
+            MaterialDataManager&,
+            const BehaviourIntegrationOptions&,
+            const real,
+            mgis::span<const size_type>);
+  /*!
+   * \brief integrate the behaviour over the integration points selected by a
+   * mask using a thread pool to parallelize the integration.
+   * \return the result of the behaviour integration.
+   * \param[in,out] p: thread pool
+   * \param[in,out] m: material data manager
+   * \param[in] c: description of the operation to be performed
+   * \param[in] dt: time step
+   * \param[in] mask: mask. The size of the mask must be equal to the number
+   * of integration points.
+   */
+  MGIS_EXPORT MultiThreadedBehaviourIntegrationResult
+  integrate(mgis::ThreadPool&,
+            MaterialDataManager&,
+            const BehaviourIntegrationOptions&,
+            const real,
+            const std::vector<bool>&);
   /*!
    * \brief integrate the behaviour for a range of integration points.
    * \return an exit status. The returned value has the following meaning:
@@ -397,6 +954,93 @@ namespace mgis::behaviour {
                         ThreadPool&,
                         MaterialDataManager&,
                         const std::string_view);
+  /*!
+   * \brief execute the given post-processing  over all integration points using
+   * a thread pool to parallelize the integration.
+   * \param[out] outputs: post-processing results
+   * \param[in,out] p: thread pool
+   * \param[in,out] d: material data manager
+   * \param[in] n: name of the post-processing
+   * \param[in] s: scheduling options
+   */
+  MGIS_EXPORT MultiThreadedBehaviourIntegrationResult
+  executePostProcessing(mgis::span<real>,
+                        ThreadPool&,
+                        MaterialDataManager&,
+                        const std::string_view,
+                        const mgis::SchedulingOptions&);
+  /*!
+   * \brief execute the given post-processing over a list of integration
+   * points
+   * \param[out] outputs: post-processing results, given for all integration
+   * points
+   * \param[in,out] d: material data manager
+   * \param[in] n: name of the post-processing
+   * \param[in] indices: indices of the integration points
+   * \note the list of integration points may be unsorted, but must not
+   * contain duplicates.
+   */
+  MGIS_EXPORT BehaviourIntegrationResult
+  executePostProcessing(mgis::span<real>,
+                        MaterialDataManager&,
+                        const std::string_view,
+                        mgis::span<const size_type>);
+  /*!
+   * \brief execute the given post-processing over the integration points
+   * selected by a mask
+   * \param[out] outputs: post-processing results, given for all integration
+   * points
+   * \param[in,out] d: material data manager
+   * \param[in] n: name of the post-processing
+   * \param[in] mask: mask. The size of the mask must be equal to the number
+   * of integration points.
+   */
+  MGIS_EXPORT BehaviourIntegrationResult
+  executePostProcessing(mgis::span<real>,
+                        MaterialDataManager&,
+                        const std::string_view,
+                        const std::vector<bool>&);
+  /*!
+   * \brief execute the given post-processing over a list of integration
+   * points using a thread pool to parallelize the integration.
+   * \param[out] outputs: post-processing results, given for all integration
+   * points
+   * \param[in,out] p: thread pool
+   * \param[in,out] d: material data manager
+   * \param[in] n: name of the post-processing
+   * \param[in] indices: indices of the integration points
+   * \param[in] s: scheduling options
+   *
+   * \note the list of integration points is split between the threads.
+   * \note the list of integration points may be unsorted, but must not
+   * contain duplicates.
+   */
+  MGIS_EXPORT MultiThreadedBehaviourIntegrationResult
+  executePostProcessing(mgis::span<real>,
+                        ThreadPool&,
+                        MaterialDataManager&,
+                        const std::string_view,
+                        mgis::span<const size_type>,
+                        const mgis::SchedulingOptions&);
+  /*!
+   * \brief execute the given post-processing over the integration points
+   * selected by a mask using a thread pool to parallelize the integration.
+   * \param[out] outputs: post-processing results, given for all integration
+   * points
+   * \param[in,out] p: thread pool
+   * \param[in,out] d: material data manager
+   * \param[in] n: name of the post-processing
+   * \param[in] mask: mask. The size of the mask must be equal to the number
+   * of integration points.
+   * \param[in] s: scheduling options
+   */
+  MGIS_EXPORT MultiThreadedBehaviourIntegrationResult
+  executePostProcessing(mgis::span<real>,
+                        ThreadPool&,
+                        MaterialDataManager&,
+                        const std::string_view,
+                        const std::vector<bool>&,
+                        const mgis::SchedulingOptions&);
 
 }  // end of namespace mgis::behaviour
 
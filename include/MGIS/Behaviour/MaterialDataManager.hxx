@@ -16,11 +16,14 @@
 #define LIB_MGIS_BEHAVIOUR_MATERIALDATAMANAGER_HXX
 
 #include <map>
+#include <mutex>
 #include <thread>
 #include <memory>
 #include <vector>
 #include "MGIS/Config.hxx"
 #include "MGIS/Behaviour/MaterialStateManager.hxx"
+#include "MGIS/Behaviour/GatherPlan.hxx"
+#include "MGIS/Behaviour/TangentOperatorStorage.hxx"
 
 namespace mgis::behaviour {
 
@@ -47,6 +50,28 @@ namespace mgis::behaviour {
     ~BehaviourIntegrationWorkSpace();
     //! \brief a buffer to hold error messages
     std::vector<char> error_message;
+    /*!
+     * \brief a buffer used to store the tangent operator blocks computed by
+     * the behaviour before packing, if required (see the
+     * `TangentOperatorStorage` enumeration)
+     */
+    std::vector<mgis::real> K;
+    /*!
+     * \brief buffers used to convert the state of an integration point to
+     * double precision in the single precision storage mode (see the
+     * `StateStoragePrecision` enumeration)
+     */
+    std::vector<mgis::real> gradients0;
+    //! \copydoc gradients0
+    std::vector<mgis::real> gradients1;
+    //! \copydoc gradients0
+    std::vector<mgis::real> thermodynamic_forces0;
+    //! \copydoc gradients0
+    std::vector<mgis::real> thermodynamic_forces1;
+    //! \copydoc gradients0
+    std::vector<mgis::real> internal_state_variables0;
+    //! \copydoc gradients0
+    std::vector<mgis::real> internal_state_variables1;
     //! material properties at the beginning of the time step
     std::vector<mgis::real> mps0;
     //! material properties at the end of the time step
@@ -88,6 +113,15 @@ namespace mgis::behaviour {
      * end of the time step.
      */
     MaterialStateManagerInitializer s1;
+    /*!
+     * \brief storage mode of the tangent operator blocks. See the
+     * `TangentOperatorStorage` enumeration for details.
+     *
+     * \note if the `K` member is not empty, its size must be consistent with
+     * this storage mode.
+     */
+    TangentOperatorStorage tangent_operator_storage =
+        TangentOperatorStorage::FULL_BLOCKS;
   };  // end of MaterialDataManagerInitializer
 
   /*!
@@ -101,6 +135,35 @@ namespace mgis::behaviour {
    * - The internal state variables are treated as a block.
    */
   struct MGIS_EXPORT MaterialDataManager {
+    /*!
+     * \brief policy used by the `update` function to copy the state at the
+     * end of the time step into the state at the beginning of the time step.
+     */
+    enum struct UpdatePolicy {
+      //! \brief the values are copied (default)
+      COPY_VALUES,
+      /*!
+       * \brief the locally allocated arrays are swapped in constant time. The
+       * arrays stored externally are still copied. See the `swapValues`
+       * function for details.
+       */
+      SWAP_BUFFERS
+    };  // end of enum struct UpdatePolicy
+    /*!
+     * \brief policy used by the `update` and `revert` functions to reset
+     * the stiffness matrices.
+     */
+    enum struct TangentOperatorResetPolicy {
+      //! \brief the stiffness matrices are filled with zeros (default)
+      EAGER_RESET,
+      /*!
+       * \brief the stiffness matrices are not modified by the `update` and
+       * `revert` functions. The stiffness matrix of an integration point is
+       * overwritten by the `integrate` functions if the tangent operator is
+       * requested, and filled with zeros if the integration fails.
+       */
+      LAZY_RESET
+    };  // end of enum struct TangentOperatorResetPolicy
     /*!
      * \brief main constructor
      * \param[in] behaviour: behaviour
@@ -122,6 +185,35 @@ namespace mgis::behaviour {
      * \param[in] bv: boolean
      */
     void setThreadSafe(const bool);
+    /*!
+     * \brief set the policy used by the `update` function.
+     * \param[in] p: update policy
+     *
+     * \note The `SWAP_BUFFERS` policy is opt-in since, after a call to
+     * `update`, the state at the end of the time step contains the values of
+     * the state at the beginning of the previous time step and views (raw
+     * pointers, `mgis::span`) to the locally allocated arrays of both states
+     * are exchanged. In particular, the gradients at the end of the time step
+     * must be fully rewritten before the next integration.
+     */
+    void setUpdatePolicy(const UpdatePolicy);
+    //! \return the policy used by the `update` function
+    UpdatePolicy getUpdatePolicy() const;
+    /*!
+     * \brief set the policy used by the `update` and `revert` functions to
+     * reset the stiffness matrices.
+     * \param[in] p: reset policy
+     *
+     * \note The `LAZY_RESET` policy avoids a pass over the stiffness matrices
+     * at each time step, which is significant for large meshes. It is
+     * opt-in since, after a call to `update`, the stiffness matrices of the
+     * integration points which have not been integrated yet, or which have
+     * been integrated without requesting the tangent operator, contain the
+     * values computed at the previous time step.
+     */
+    void setTangentOperatorResetPolicy(const TangentOperatorResetPolicy);
+    //! \return the policy used to reset the stiffness matrices
+    TangentOperatorResetPolicy getTangentOperatorResetPolicy() const;
     /*!
      * \brief allocate the memory associated with the tangent operator blocks if
      * required.
@@ -186,13 +278,61 @@ namespace mgis::behaviour {
      * removed.
      */
     void releaseArrayOfSpeedOfSounds();
+    /*!
+     * \brief allocate the memory used to record the cost of the integration
+     * of each integration point, if required.
+     *
+     * Once this memory is allocated, the `integrate` functions record the
+     * time spent in the integration of each integration point and the
+     * multi-threaded version of the `integrate` function uses the recorded
+     * costs to split the integration points in blocks of equal costs.
+     * This is meant to balance the load between threads when the same
+     * material data manager is integrated many times (for instance during
+     * the iterations of a Newton-Raphson algorithm).
+     *
+     * \note This method is thread-safe if the `thread_safe` is `true`.
+     * In this case, the memory allocation is guarded by a mutex.
+     * See the `setThreadSafe` method for details
+     */
+    void allocateArrayOfIntegrationCosts();
+    /*!
+     * \brief release the memory used to record the integration costs. This
+     * disables the cost-based load balancing of the multi-threaded
+     * integrations.
+     */
+    void releaseArrayOfIntegrationCosts();
     /*!
      * \brief return a workspace associated with the given behaviour.
      *
      * \note This method returns a object per thread if the `thread_safe` member
-     * is `true`.
+     * is `true`. In this case, the workspaces are stored in a map guarded by
+     * a mutex. Tasks executed by a thread pool shall prefer the version of
+     * this method taking the index of the worker as argument.
      */
     BehaviourIntegrationWorkSpace& getBehaviourIntegrationWorkSpace();
+    /*!
+     * \brief reserve the workspaces associated with the workers of a thread
+     * pool.
+     *
+     * \param[in] nth: number of workers
+     *
+     * \note This method is not thread-safe and must be called before
+     * distributing tasks to the workers.
+     */
+    void reserveBehaviourIntegrationWorkSpaces(const size_type);
+    /*!
+     * \brief return the workspace associated with the given worker.
+     *
+     * \param[in] i: index of the worker (see the
+     * `ThreadPool::getCurrentWorkerIndex` method)
+     *
+     * \note This method does not require any lock. The number of workspaces
+     * must have been reserved using the
+     * `reserveBehaviourIntegrationWorkSpaces` method and a given index must
+     * only be used by one thread at a time.
+     */
+    BehaviourIntegrationWorkSpace& getBehaviourIntegrationWorkSpace(
+        const size_type);
     /*!
      * \brief clear behaviour integration workspaces.
      *
@@ -200,6 +340,18 @@ namespace mgis::behaviour {
      * pools.
      */
     void releaseBehaviourIntegrationWorkspaces();
+    /*!
+     * \brief return the plan describing how the material properties and the
+     * external state variables are gathered for each integration point.
+     *
+     * The plan is cached and only rebuilt if the layout of the material
+     * properties or the external state variables changed since the last call
+     * (see the `isGatherPlanValid` function).
+     *
+     * \note This method is thread-safe if the `thread_safe` is `true`.
+     * In this case, the access to the cached plan is guarded by a mutex.
+     */
+    std::shared_ptr<const GatherPlan> getGatherPlan();
     //! \brief destructor
     ~MaterialDataManager();
     //! \brief state at the beginning of the time step
@@ -212,8 +364,23 @@ namespace mgis::behaviour {
     real rdt;
     //! \brief view on the speed of sound.
     mgis::span<real> speed_of_sound;
+    /*!
+     * \brief view on the time, in seconds, spent in the last integration of
+     * each integration point. This array is empty unless the
+     * `allocateArrayOfIntegrationCosts` method has been called.
+     */
+    mgis::span<real> integration_costs;
     //! \brief number of integration points
     const size_type n;
+    /*!
+     * \brief storage mode of the tangent operator blocks.
+     *
+     * \note with the `PACKED_SYMMETRIC_BLOCKS` storage mode, the `K` member
+     * can't be passed directly to the functions expecting full blocks (such
+     * as the `rotateTangentOperatorBlocks` functions). See the
+     * `unpackTangentOperatorBlocks` functions.
+     */
+    const TangentOperatorStorage tangent_operator_storage;
     /*!
      * \brief the size of the stiffness matrix for one integration point (the
      * size of K is K_stride times the number of integration points)
@@ -235,20 +402,41 @@ namespace mgis::behaviour {
     std::vector<real> K_values;
     //! \brief values of the speed of sound, if hold internally.
     std::vector<real> speed_of_sound_values;
+    //! \brief values of the integration costs, if required.
+    std::vector<real> integration_costs_values;
     //! \brief integration workspace for individual threads.
     std::map<std::thread::id, std::unique_ptr<BehaviourIntegrationWorkSpace>>
         iwks;
+    //! \brief integration workspaces indexed by the workers' indices.
+    std::vector<std::unique_ptr<BehaviourIntegrationWorkSpace>> worker_iwks;
     //! \brief a pointer to an integration workspace
     std::unique_ptr<BehaviourIntegrationWorkSpace> iwk;
+    //! \brief mutex protecting the `iwks` member
+    std::mutex iwks_mutex;
+    //! \brief cached gather plan
+    std::shared_ptr<const GatherPlan> gather_plan;
+    //! \brief mutex protecting the `gather_plan` member
+    std::mutex gather_plan_mutex;
     //! \brief boolean stating if thread safety must be unsured
     bool thread_safe = true;
+    //! \brief policy used by the `update` function
+    UpdatePolicy update_policy = UpdatePolicy::COPY_VALUES;
+    //! \brief policy used to reset the stiffness matrices
+    TangentOperatorResetPolicy K_reset_policy =
+        TangentOperatorResetPolicy::EAGER_RESET;
   };  // end of struct MaterialDataManager
 
   /*!
    * \brief update the behaviour data by:
-   * - setting s1 equal to s0
+   * - setting s0 equal to s1
    * - filling the stiffness matrix with 0
    * \param[in,out] m: material data manager
+   *
+   * \note if the update policy of the material data manager is
+   * `SWAP_BUFFERS`, the locally allocated arrays of s0 and s1 are swapped
+   * rather than copied.
+   * \note the stiffness matrix is not modified if the tangent operator reset
+   * policy of the material data manager is `LAZY_RESET`.
    */
   MGIS_EXPORT void update(MaterialDataManager&);
   /*!
@@ -256,8 +444,28 @@ namespace mgis::behaviour {
    * - setting s1 equal to s0
    * - filling the stiffness matrix with 0
    * \param[in,out] m: material data manager
+   *
+   * \note the values are always copied, whatever the update policy.
+   * \note the stiffness matrix is not modified if the tangent operator reset
+   * policy of the material data manager is `LAZY_RESET`.
    */
   MGIS_EXPORT void revert(MaterialDataManager&);
+  /*!
+   * \brief update the behaviour data as the sequential version of this
+   * function, distributing the integration points between the threads of a
+   * thread pool.
+   * \param[in,out] p: thread pool
+   * \param[in,out] m: material data manager
+   */
+  MGIS_EXPORT void update(mgis::ThreadPool&, MaterialDataManager&);
+  /*!
+   * \brief revert the behaviour data as the sequential version of this
+   * function, distributing the integration points between the threads of a
+   * thread pool.
+   * \param[in,out] p: thread pool
+   * \param[in,out] m: material data manager
+   */
+  MGIS_EXPORT void revert(mgis::ThreadPool&, MaterialDataManager&);
 
   /*!
    * \return an array containing the results of a post-processing.
@@ -21,14 +21,72 @@
 #include <variant>
 #include "MGIS/Config.hxx"
 #include "MGIS/Span.hxx"
+#include "MGIS/AlignedAllocator.hxx"
 #include "MGIS/StorageMode.hxx"
 #include "MGIS/StringView.hxx"
 
+namespace mgis {
+
+  // forward declaration
+  struct ThreadPool;
+
+}  // end of namespace mgis
+
 namespace mgis::behaviour {
 
   // forward declaration
   struct Behaviour;
 
+}  // end of namespace mgis::behaviour
+
+namespace mgis::behaviour::internals {
+
+  // forward declaration
+  struct SwapValuesImplementation;
+
+}  // end of namespace mgis::behaviour::internals
+
+namespace mgis::behaviour {
+
+  /*!
+   * \brief precision used to store the gradients, the thermodynamic forces
+   * and the internal state variables in a material state manager.
+   */
+  enum struct StateStoragePrecision {
+    //! \brief values are stored in double precision (default)
+    DOUBLE_PRECISION,
+    /*!
+     * \brief values are stored in single precision (`float`).
+     *
+     * This storage mode roughly halves the memory footprint of the state and
+     * the memory bandwidth required by the integration, which is meaningful
+     * when the number of integration points is limited by the available
+     * memory, e.g. in explicit dynamics.
+     *
+     * The behaviours are still integrated in double precision: the values
+     * of an integration point are converted to double precision in a
+     * temporary buffer before the call to the behaviour, and the updated
+     * thermodynamic forces and internal state variables are rounded to
+     * single precision afterwards.
+     *
+     * \warning the relative precision of the stored values is thus about
+     * \f$10^{-7}\f$. This rounding error is introduced at each time step,
+     * which may be an issue for:
+     *
+     * - implicit schemes relying on tight convergence criteria (the
+     *   equilibrium residual can't be lower than the rounding error of the
+     *   stresses) or on small increments of the gradients (which may be
+     *   lost when added to large values).
+     * - internal state variables which are accumulated over many time steps
+     *   with small increments (equivalent plastic strain, damage, etc.).
+     *
+     * \note the material properties, the external state variables, the
+     * stored and dissipated energies and the tangent operator are always
+     * stored in double precision.
+     */
+    SINGLE_PRECISION
+  };  // end of enum struct StateStoragePrecision
+
   /*!
    * \brief a structure in charge of holding information on how a material
    * state manager shall be initialized.
@@ -78,6 +136,33 @@ namespace mgis::behaviour {
      * energy.
      */
     mgis::span<mgis::real> dissipated_energies;
+    /*!
+     * \brief precision used to store the gradients, the thermodynamic forces
+     * and the internal state variables. See the `StateStoragePrecision`
+     * enumeration for details.
+     *
+     * \note the single precision storage mode is not compatible with
+     * externally allocated memory for the gradients, the thermodynamic forces
+     * and the internal state variables.
+     */
+    StateStoragePrecision precision = StateStoragePrecision::DOUBLE_PRECISION;
+    /*!
+     * \brief thread pool used to initialize the arrays allocated by the
+     * material state manager. If not null, the integration points are split
+     * as in the multi-threaded integration functions (see the
+     * `getUniformPartition` function) and the `i`th block is initialized
+     * by the `i`th thread of this thread pool, as it is treated by the
+     * multi-threaded integration functions with the static scheduling
+     * policy. With the first-touch policy of most operating systems, the
+     * memory pages associated with a block are then allocated on the NUMA
+     * node of the thread which initialized it.
+     *
+     * \note this is only meaningful if the threads of the pool are bound to
+     * the processors (see the `ThreadPoolOptions` structure) and if the
+     * integration uses the static scheduling policy and a uniform partition
+     * of the integration points.
+     */
+    mgis::ThreadPool* thread_pool = nullptr;
   };  // end of MaterialStateManagerInitializer
 
   /*!
@@ -89,8 +174,13 @@ namespace mgis::behaviour {
    * - The material properties and the external state variables are treated
    *   individually. They can be uniform or spatially variable.
    * - The internal state variables are treated as a block.
+   * - The arrays allocated internally are aligned on cache lines, or on huge
+   *   pages for large arrays (see the `AlignedAllocator` class).
    */
   struct MGIS_EXPORT MaterialStateManager {
+    //! \brief type of the arrays allocated internally
+    template <typename ValueType>
+    using Array = std::vector<ValueType, mgis::AlignedAllocator<ValueType>>;
     //! \brief a simple alias
     using FieldHolder =
         std::variant<real, mgis::span<mgis::real>, std::vector<mgis::real>>;
@@ -116,11 +206,17 @@ namespace mgis::behaviour {
                          const MaterialStateManagerInitializer&);
     //! \brief destructor
     ~MaterialStateManager();
-    //! \brief view to the values of the gradients
+    /*!
+     * \brief view to the values of the gradients
+     * \note this view is empty in the single precision storage mode.
+     */
     mgis::span<mgis::real> gradients;
     //! stride associate with the gradients
     const size_type gradients_stride;
-    //! \brief view to the values of the thermodynamic_forces
+    /*!
+     * \brief view to the values of the thermodynamic_forces
+     * \note this view is empty in the single precision storage mode.
+     */
     mgis::span<mgis::real> thermodynamic_forces;
     //! stride associate with the thermodynamic forces
     const size_type thermodynamic_forces_stride;
@@ -141,7 +237,10 @@ namespace mgis::behaviour {
      * case).
      */
     std::map<std::string, FieldHolder> material_properties;
-    //! \brief view to the values of the internal state variables
+    /*!
+     * \brief view to the values of the internal state variables
+     * \note this view is empty in the single precision storage mode.
+     */
     mgis::span<mgis::real> internal_state_variables;
     /*!
      * \brief stride associate with internal state variables.
@@ -158,22 +257,61 @@ namespace mgis::behaviour {
      * case).
      */
     std::map<std::string, FieldHolder> external_state_variables;
+    /*!
+     * \brief view to the values of the gradients in the single precision
+     * storage mode (empty otherwise).
+     */
+    mgis::span<float> single_precision_gradients;
+    /*!
+     * \brief view to the values of the thermodynamic forces in the single
+     * precision storage mode (empty otherwise).
+     */
+    mgis::span<float> single_precision_thermodynamic_forces;
+    /*!
+     * \brief view to the values of the internal state variables in the single
+     * precision storage mode (empty otherwise).
+     */
+    mgis::span<float> single_precision_internal_state_variables;
+    /*!
+     * \brief counter incremented each time the layout of the material
+     * properties or the external state variables is modified by the
+     * `setMaterialProperty`, `setExternalStateVariable`, `updateValues` and
+     * `swapValues` functions. This counter is used to invalidate the gather
+     * plans cached by the material data managers.
+     */
+    size_type layout_version = 0;
     //! \brief number of integration points
     const size_type n;
+    //! \brief precision used to store the state
+    const StateStoragePrecision precision;
     //! underlying behaviour
     const Behaviour& b;
 
    private:
+    // the swapValues functions need to swap the locally allocated arrays
+    friend struct internals::SwapValuesImplementation;
     //! \brief value of the gradients, if hold internally
-    std::vector<mgis::real> gradients_values;
+    Array<mgis::real> gradients_values;
     //! \brief value of the thermodynamic forces, if hold internally
-    std::vector<mgis::real> thermodynamic_forces_values;
+    Array<mgis::real> thermodynamic_forces_values;
     //! \brief value of the internal state variables, if hold internally
-    std::vector<mgis::real> internal_state_variables_values;
+    Array<mgis::real> internal_state_variables_values;
     //! \brief value of the stored energies, if hold internally
-    std::vector<mgis::real> stored_energies_values;
+    Array<mgis::real> stored_energies_values;
     //! \brief value of the dissipated energies, if hold internally
-    std::vector<mgis::real> dissipated_energies_values;
+    Array<mgis::real> dissipated_energies_values;
+    //! \brief value of the gradients in the single precision storage mode
+    Array<float> single_precision_gradients_values;
+    /*!
+     * \brief value of the thermodynamic forces in the single precision storage
+     * mode
+     */
+    Array<float> single_precision_thermodynamic_forces_values;
+    /*!
+     * \brief value of the internal state variables in the single precision
+     * storage mode
+     */
+    Array<float> single_precision_internal_state_variables_values;
     //! \brief move constructor
     MaterialStateManager(MaterialStateManager&&) = delete;
     //! \brief copy constructor
@@ -270,6 +408,55 @@ namespace mgis::behaviour {
    */
   MGIS_EXPORT void updateValues(MaterialStateManager&,
                                 const MaterialStateManager&);
+  /*!
+   * \brief update the values of a state from another state by swapping the
+   * locally allocated arrays.
+   *
+   * The arrays (gradients, thermodynamic forces, internal state variables,
+   * energies) and the spatially variable material properties and external
+   * state variables are swapped in constant time if they are allocated
+   * locally by both states. Otherwise, the values of the input state are
+   * copied in the output state, as in the `updateValues` function.
+   *
+   * \param[out] o: output state
+   * \param[in,out] i: input state
+   *
+   * \note after this call, the input state contains either the values of the
+   * output state before the call (swapped arrays) or its own values (copied
+   * arrays). Hence, the input state must be fully rewritten before being
+   * used.
+   * \note views on the locally allocated arrays (pointers, `mgis::span`)
+   * obtained before the call refer to the other state after the call.
+   */
+  MGIS_EXPORT void swapValues(MaterialStateManager&, MaterialStateManager&);
+  /*!
+   * \brief update the values of a state from another state, distributing
+   * the copies of the arrays between the threads of a thread pool.
+   * \param[in,out] p: thread pool
+   * \param[out] o: output state
+   * \param[in] i: input state
+   *
+   * \note the integration points are split in contiguous blocks and each
+   * task copies the values of all the arrays associated with its block.
+   * \note the material properties and the external state variables are
+   * updated sequentially.
+   */
+  MGIS_EXPORT void updateValues(mgis::ThreadPool&,
+                                MaterialStateManager&,
+                                const MaterialStateManager&);
+  /*!
+   * \brief update the values of a state from another state by swapping the
+   * locally allocated arrays. The arrays which can't be swapped are copied
+   * by the threads of the given thread pool.
+   * \param[in,out] p: thread pool
+   * \param[out] o: output state
+   * \param[in,out] i: input state
+   *
+   * \note see the sequential version of this function for details.
+   */
+  MGIS_EXPORT void swapValues(mgis::ThreadPool&,
+                              MaterialStateManager&,
+                              MaterialStateManager&);
   /*!
    * \brief extract an internal state variable
    *
@@ -279,8 +466,25 @@ namespace mgis::behaviour {
    * \param[in] n: name of the internal state variables
    *
    * \note the output buffer must be allocated properly
+   * \note in the single precision storage mode, the values are converted to
+   * double precision.
+   */
+  MGIS_EXPORT void extractInternalStateVariable(
+      mgis::span<mgis::real>,
+      const mgis::behaviour::MaterialStateManager&,
+      const mgis::string_view);
+  /*!
+   * \brief extract an internal state variable, distributing the integration
+   * points between the threads of a thread pool.
+   *
+   * \param[in,out] p: thread pool
+   * \param[out] o: buffer in which the values of the given internal state
+   * variable is stored
+   * \param[in] s: material state manager
+   * \param[in] n: name of the internal state variables
    */
   MGIS_EXPORT void extractInternalStateVariable(
+      mgis::ThreadPool&,
       mgis::span<mgis::real>,
       const mgis::behaviour::MaterialStateManager&,
       const mgis::string_view);
@@ -0,0 +1,119 @@
+/*!
+ * \file   include/MGIS/Behaviour/PersistentBehaviourCache.hxx
+ * \brief  This file declares the functions handling the persistent cache of
+ * the descriptions of the behaviours.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_BEHAVIOUR_PERSISTENTBEHAVIOURCACHE_HXX
+#define LIB_MGIS_BEHAVIOUR_PERSISTENTBEHAVIOURCACHE_HXX
+
+#include <iosfwd>
+#include <string>
+#include <optional>
+#include "MGIS/Config.hxx"
+#include "MGIS/Behaviour/Hypothesis.hxx"
+
+namespace mgis::behaviour {
+
+  // forward declaration
+  struct Behaviour;
+
+  /*!
+   * \brief key identifying a version of a library in the persistent cache
+   * of the descriptions of the behaviours.
+   */
+  struct PersistentBehaviourCacheKey {
+    //! \brief path of the library
+    std::string path;
+    //! \brief last modification time of the library
+    long long modification_time = 0;
+    //! \brief version of `TFEL` used to generate the behaviour
+    std::string tfel_version;
+  };  // end of struct PersistentBehaviourCacheKey
+
+  /*!
+   * \brief enable or disable the persistent cache of the descriptions of the
+   * behaviours.
+   *
+   * If enabled, the `load` functions store the description of the
+   * behaviours in a file written next to the library, called
+   * `<library>.<behaviour>.<hypothesis>.mgis`. This file is read by the
+   * following calls to the `load` functions, in the current process or in
+   * other processes, as long as the library is not modified. Only the
+   * function pointers are then retrieved from the library.
+   *
+   * \param[in] b: boolean
+   *
+   * \note the persistent cache is disabled by default.
+   * \note the files are written atomically: a temporary file is first
+   * written and then renamed. Failures to write those files are silently
+   * ignored (read-only directories, for instance).
+   */
+  MGIS_EXPORT void usePersistentBehaviourCache(const bool);
+  //! \return if the persistent cache is enabled
+  MGIS_EXPORT bool isPersistentBehaviourCacheUsed();
+  /*!
+   * \brief write the description of a behaviour, excluding the function
+   * pointers.
+   * \param[out] os: output stream
+   * \param[in] k: key associated with the library
+   * \param[in] b: behaviour
+   */
+  MGIS_EXPORT void writeBehaviourDescription(std::ostream &,
+                                             const PersistentBehaviourCacheKey &,
+                                             const Behaviour &);
+  /*!
+   * \brief read the description of a behaviour written by the
+   * `writeBehaviourDescription` function.
+   * \return the description of the behaviour, or an empty value if the
+   * given stream is invalid or if the key does not match. The function
+   * pointers of the returned description are null.
+   * \note the sizes read from the stream are bounded, so that corrupted
+   * streams do not lead to huge allocations.
+   * \param[in] is: input stream
+   * \param[in] k: expected key
+   */
+  MGIS_EXPORT std::optional<Behaviour> readBehaviourDescription(
+      std::istream &, const PersistentBehaviourCacheKey &);
+
+}  // end of namespace mgis::behaviour
+
+namespace mgis::behaviour::internals {
+
+  /*!
+   * \return the key associated with the given library in the persistent
+   * cache, if it can be determined.
+   * \param[in] l: library
+   * \param[in] b: behaviour
+   */
+  MGIS_EXPORT std::optional<PersistentBehaviourCacheKey>
+  getPersistentBehaviourCacheKey(const std::string &, const std::string &);
+  /*!
+   * \return the description of a behaviour stored in the persistent cache,
+   * if any. The function pointers of the returned description are null.
+   * \param[in] k: key associated with the library
+   * \param[in] b: behaviour
+   * \param[in] h: modelling hypothesis
+   */
+  MGIS_EXPORT std::optional<Behaviour> readPersistentBehaviourCache(
+      const PersistentBehaviourCacheKey &, const std::string &, const Hypothesis);
+  /*!
+   * \brief store the description of a behaviour in the persistent cache.
+   * \param[in] k: key associated with the library
+   * \param[in] d: behaviour
+   */
+  MGIS_EXPORT void writePersistentBehaviourCache(
+      const PersistentBehaviourCacheKey &, const Behaviour &);
+
+}  // end of namespace mgis::behaviour::internals
+
+#endif /* LIB_MGIS_BEHAVIOUR_PERSISTENTBEHAVIOURCACHE_HXX */
@@ -0,0 +1,135 @@
+/*!
+ * \file   include/MGIS/Behaviour/TangentOperatorStorage.hxx
+ * \brief  This file declares the functions used to store the tangent
+ * operator blocks in a packed form.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_BEHAVIOUR_TANGENTOPERATORSTORAGE_HXX
+#define LIB_MGIS_BEHAVIOUR_TANGENTOPERATORSTORAGE_HXX
+
+#include "MGIS/Config.hxx"
+#include "MGIS/Span.hxx"
+
+namespace mgis::behaviour {
+
+  // forward declaration
+  struct Behaviour;
+  // forward declaration
+  struct MaterialDataManager;
+
+  /*!
+   * \brief list of the storage modes of the tangent operator blocks in a
+   * material data manager.
+   */
+  enum struct TangentOperatorStorage {
+    /*!
+     * \brief the tangent operator blocks are stored as dense row-major
+     * matrices, as returned by the behaviour (default).
+     */
+    FULL_BLOCKS,
+    /*!
+     * \brief each tangent operator block is assumed symmetric and only its
+     * upper triangular part is stored, row by row. A block of size
+     * \f$n\times n\f$ thus requires \f$n\,(n+1)/2\f$ values, i.e. `21`
+     * values instead of `36` for the tangent operator of a small strain
+     * behaviour in \f$3D\f$.
+     *
+     * This storage mode is only available if all the tangent operator blocks
+     * are square. The symmetric part of the blocks computed by the behaviour
+     * is stored, which is only meaningful if the tangent operator is known
+     * to be symmetric.
+     */
+    PACKED_SYMMETRIC_BLOCKS
+  };  // end of enum struct TangentOperatorStorage
+
+  /*!
+   * \return the number of values required to store the tangent operator
+   * blocks of one integration point using the
+   * `PACKED_SYMMETRIC_BLOCKS` storage mode.
+   * \param[in] b: behaviour
+   *
+   * \note an exception is thrown if one tangent operator block is not
+   * square.
+   */
+  MGIS_EXPORT mgis::size_type getPackedTangentOperatorArraySize(
+      const Behaviour&);
+  /*!
+   * \return the number of values required to store the tangent operator
+   * blocks of one integration point using the given storage mode.
+   * \param[in] b: behaviour
+   * \param[in] s: storage mode
+   */
+  MGIS_EXPORT mgis::size_type getTangentOperatorArraySize(
+      const Behaviour&, const TangentOperatorStorage);
+  /*!
+   * \brief pack the tangent operator blocks of one integration point. No
+   * bounds check is made, use with care.
+   * \param[out] Kp: packed tangent operator blocks
+   * \param[in] K: tangent operator blocks
+   * \param[in] b: behaviour
+   */
+  MGIS_EXPORT void packTangentOperatorBlocks(real* const,
+                                             const real* const,
+                                             const Behaviour&);
+  /*!
+   * \brief unpack the tangent operator blocks of one integration point. No
+   * bounds check is made, use with care.
+   * \param[out] K: tangent operator blocks
+   * \param[in] Kp: packed tangent operator blocks
+   * \param[in] b: behaviour
+   */
+  MGIS_EXPORT void unpackTangentOperatorBlocks(real* const,
+                                               const real* const,
+                                               const Behaviour&);
+  /*!
+   * \brief copy the tangent operator blocks of one integration point as
+   * dense row-major matrices, whatever the storage mode of the material
+   * data manager.
+   * \param[out] K: tangent operator blocks
+   * \param[in] m: material data manager
+   * \param[in] i: integration point
+   */
+  MGIS_EXPORT void unpackTangentOperatorBlocks(mgis::span<real>,
+                                               const MaterialDataManager&,
+                                               const mgis::size_type);
+  /*!
+   * \brief copy the tangent operator blocks of all integration points as
+   * dense row-major matrices, whatever the storage mode of the material
+   * data manager.
+   * \param[out] K: tangent operator blocks
+   * \param[in] m: material data manager
+   */
+  MGIS_EXPORT void unpackTangentOperatorBlocks(mgis::span<real>,
+                                               const MaterialDataManager&);
+  /*!
+   * \brief compute the product of the tangent operator of one integration
+   * point by an increment of the gradients, whatever the storage mode of the
+   * material data manager. This function is meant to be used in assembly
+   * procedures, without unpacking the tangent operator blocks.
+   *
+   * \param[out] dt: increment of the thermodynamic forces
+   * \param[in] m: material data manager
+   * \param[in] i: integration point
+   * \param[in] dg: increment of the gradients
+   *
+   * \note only the tangent operator blocks associated with the derivatives
+   * of the thermodynamic forces with respect to the gradients are taken into
+   * account.
+   */
+  MGIS_EXPORT void multiplyByTangentOperator(mgis::span<real>,
+                                             const MaterialDataManager&,
+                                             const mgis::size_type,
+                                             mgis::span<const real>);
+
+}  // end of namespace mgis::behaviour
+
+#endif /* LIB_MGIS_BEHAVIOUR_TANGENTOPERATORSTORAGE_HXX */
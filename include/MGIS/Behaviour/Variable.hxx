@@ -17,6 +17,7 @@
 
 #include <string>
 #include <vector>
+#include <unordered_map>
 #include "MGIS/Config.hxx"
 #include "MGIS/StringView.hxx"
 #include "MGIS/Behaviour/Hypothesis.hxx"
@@ -51,6 +52,53 @@ namespace mgis::behaviour {
     int type_identifier = 0;
   };  // end of struct Variable
 
+  //! \brief position of a variable in an array of values
+  struct VariableLocation {
+    //! \brief position of the variable in the list of variables
+    size_type index = 0;
+    //! \brief offset of the variable in the array of values
+    size_type offset = 0;
+    //! \brief size of the variable
+    size_type size = 0;
+    //! \brief type of the variable when the index was built
+    Variable::Type type = Variable::SCALAR;
+    //! \brief type identifier of the variable when the index was built
+    int type_identifier = 0;
+  };  // end of struct VariableLocation
+
+  /*!
+   * \brief an index allowing to retrieve the position of a variable from its
+   * name without scanning a list of variables.
+   *
+   * The index is built for a given list of variables and a given modelling
+   * hypothesis by the `buildVariablesIndex` function. An index is only used
+   * if it is consistent with the list of variables given to the lookup
+   * functions, i.e. if the number of variables and the name of the variable
+   * found match, and if the types of this variable and of the variables
+   * preceding it (which determine its offset) are unchanged. Otherwise, the
+   * lookup functions fall back to a linear scan of the list of variables.
+   *
+   * \note an index shall be rebuilt if the variables are modified, to
+   * avoid those linear scans.
+   */
+  struct VariablesIndex {
+    //! \brief modelling hypothesis
+    Hypothesis hypothesis = Hypothesis::TRIDIMENSIONAL;
+    //! \brief size of an array containing all the variables
+    size_type array_size = 0;
+    //! \brief locations of the variables, in the order of the variables
+    std::vector<VariableLocation> locations;
+    //! \brief map associating the hash of a name to a position
+    std::unordered_multimap<std::size_t, size_type> names;
+  };  // end of struct VariablesIndex
+
+  /*!
+   * \return an index of the given variables
+   * \param[in] vs: variables
+   * \param[in] h: modelling hypothesis
+   */
+  MGIS_EXPORT VariablesIndex buildVariablesIndex(const std::vector<Variable> &,
+                                                 const Hypothesis);
   /*!
    * \return a boolean stating that a variable with the given name
    * is in the container.
@@ -58,6 +106,16 @@ namespace mgis::behaviour {
    * \param[in] n: name
    */
   MGIS_EXPORT bool contains(const std::vector<Variable> &, const string_view);
+  /*!
+   * \return a boolean stating that a variable with the given name
+   * is in the container.
+   * \param[in] vs: variables
+   * \param[in] i: index of the variables
+   * \param[in] n: name
+   */
+  MGIS_EXPORT bool contains(const std::vector<Variable> &,
+                            const VariablesIndex &,
+                            const string_view);
   /*!
    * \return the variable with the given name
    * \param[in] vs: variables
@@ -65,6 +123,15 @@ namespace mgis::behaviour {
    */
   MGIS_EXPORT const Variable &getVariable(const std::vector<Variable> &,
                                           const string_view);
+  /*!
+   * \return the variable with the given name
+   * \param[in] vs: variables
+   * \param[in] i: index of the variables
+   * \param[in] n: name
+   */
+  MGIS_EXPORT const Variable &getVariable(const std::vector<Variable> &,
+                                          const VariablesIndex &,
+                                          const string_view);
   /*!
    * \return the type of a variable from an identifier
    * \param[in] id: type identifier
@@ -89,13 +156,34 @@ namespace mgis::behaviour {
    */
   MGIS_EXPORT size_type getArraySize(const std::vector<Variable> &,
                                      const Hypothesis);
+  /*!
+   * \return the size of an array that may contain the values described by the
+   * given array of variables
+   * \param[in] vs: variables
+   * \param[in] i: index of the variables
+   * \param[in] h: modelling hypothesis
+   */
+  MGIS_EXPORT size_type getArraySize(const std::vector<Variable> &,
+                                     const VariablesIndex &,
+                                     const Hypothesis);
+  /*!
+   * \return the offset of the given variable for the given hypothesis
+   * \param[in] vs: variables
+   * \param[in] n: variable name
+   * \param[in] h: modelling hypothesis
+   */
+  MGIS_EXPORT size_type getVariableOffset(const std::vector<Variable> &,
+                                          const string_view,
+                                          const Hypothesis);
   /*!
    * \return the offset of the given variable for the given hypothesis
    * \param[in] vs: variables
+   * \param[in] i: index of the variables
    * \param[in] n: variable name
    * \param[in] h: modelling hypothesis
    */
   MGIS_EXPORT size_type getVariableOffset(const std::vector<Variable> &,
+                                          const VariablesIndex &,
                                           const string_view,
                                           const Hypothesis);
   /*!
@@ -18,6 +18,8 @@
 #include <map>
 #include <string>
 #include <vector>
+#include <shared_mutex>
+#include <unordered_map>
 
 #if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
 #ifndef NOMINMAX
@@ -36,6 +38,12 @@ namespace mgis {
   /*!
    * \brief structure in charge of handling libraries and querying MGIS'
    * meta-data
+   *
+   * \note the methods of this class can be called concurrently from many
+   * threads. Already loaded libraries and already resolved symbols are
+   * retrieved under a shared lock, so that concurrent queries only
+   * serialize when a new library is opened or when a new symbol is looked
+   * for.
    */
   struct MGIS_VISIBILITY_EXPORT LibrariesManager {
 #if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
@@ -53,6 +61,11 @@ namespace mgis {
     LibrariesManager(const LibrariesManager &) = delete;
     LibrariesManager &operator=(LibrariesManager &&) = delete;
     LibrariesManager &operator=(const LibrariesManager &) = delete;
+    /*!
+     * \brief load the given library if not already loaded.
+     * \param[in] l: library name
+     */
+    void preloadLibrary(const std::string &);
     /*!
      * \return the `TFEL` version used to generate an `MGIS` entry point
      * \param[in] l: library name
@@ -91,6 +104,17 @@ namespace mgis {
      * \param[in] n: entry point name
      */
     std::string getSource(const std::string &, const std::string &);
+    /*!
+     * \return the path of the file from which the given library has been
+     * loaded. An empty string is returned if this path can't be determined.
+     * \param[in] l: library name
+     * \param[in] n: entry point name
+     *
+     * \note on POSIX systems, the path is determined from the address of the
+     * material knowledge type of the given entry point, which is exported by
+     * all entry points generated by `MFront`.
+     */
+    std::string getLibraryPath(const std::string &, const std::string &);
     /*!
      * \return the function implementing the behaviour
      * \param[in] l: library
@@ -827,16 +851,40 @@ namespace mgis {
                                        const Hypothesis,
                                        const std::string &,
                                        const std::string &);
+    //! \brief description of a loaded library
+    struct Library {
+      /*!
+       * \brief constructor
+       * \param[in] h: handler to the library
+       */
+      explicit Library(const libhandler h) : handler(h) {}
+      //! \brief handler to the library
+      const libhandler handler;
+      //! \brief mutex protecting the addresses of the symbols
+      std::shared_mutex m;
+      /*!
+       * \brief addresses of the symbols already looked for. A null address
+       * denotes a symbol which is not exported by the library.
+       */
+      std::unordered_map<std::string, void *> symbols;
+    };
     /*!
      * \brief load an external library if not already loaded. If the library
      * is
      * successfully loaded, the associated handler is stored.
      * \param[in] l: library name
-     * \return the handler to the library
+     * \return the description of the library
+     */
+    Library &loadLibrary(const std::string &);
+    //! \brief mutex protecting the list of loaded libraries
+    std::shared_mutex m;
+    /*!
+     * \brief list of alreay loaded libraries
+     *
+     * \note elements of a `std::map` are never moved, so references to the
+     * loaded libraries remain valid when new libraries are inserted.
      */
-    libhandler loadLibrary(const std::string &);
-    //! list of alreay loaded libraries
-    std::map<std::string, libhandler> libraries;
+    std::map<std::string, Library, std::less<>> libraries;
 
   };  // end of struct LibrariesManager
 
@@ -0,0 +1,230 @@
+/*!
+ * \file   include/MGIS/ParallelFor.hxx
+ * \brief  This file declares the `parallel_for` and `parallel_reduce`
+ * functions which distribute the treatment of a range of indices between
+ * the threads of a thread pool.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_PARALLELFOR_HXX
+#define LIB_MGIS_PARALLELFOR_HXX
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <future>
+#include "MGIS/Config.hxx"
+#include "MGIS/Partition.hxx"
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/SchedulingOptions.hxx"
+#include "MGIS/ThreadedTaskResult.hxx"
+
+namespace mgis::internals {
+
+  /*!
+   * \brief data shared by the tasks treating a range of indices.
+   *
+   * The indices are split in contiguous blocks, one task being associated
+   * with each block. With the static scheduling policy, each task treats its
+   * block at once. With the work-stealing scheduling policy, each block is
+   * divided in chunks which are claimed using an atomic counter per block,
+   * so that no lock is required: each task first claims the chunks of its
+   * own block, and then the chunks of the other blocks when its own block is
+   * exhausted.
+   */
+  struct MGIS_EXPORT ParallelForState {
+    /*!
+     * \brief constructor
+     * \param[in] b: boundaries of the blocks
+     * \param[in] s: scheduling options
+     */
+    ParallelForState(std::vector<size_type>, const SchedulingOptions&);
+    //! \return the number of blocks
+    size_type getNumberOfBlocks() const;
+    /*!
+     * \brief treat the indices associated with the given task.
+     * \param[in] i: index of the task
+     * \param[in] f: function treating a range of indices. This function
+     * returns false to stop the treatment. This return value is only
+     * meaningful with the work-stealing scheduling policy.
+     */
+    template <typename Function>
+    void treat(const size_type, const Function&);
+    //! \brief boundaries of the blocks
+    const std::vector<size_type> blocks;
+    //! \brief grain size. A null value denotes the static scheduling policy
+    const size_type grain_size;
+
+   private:
+    /*!
+     * \brief claim a chunk of the given block.
+     * \return false if the block is exhausted
+     * \param[out] b: first index of the chunk
+     * \param[out] e: index after the last index of the chunk
+     * \param[in] i: index of the block
+     */
+    bool claim(size_type&, size_type&, const size_type);
+    //! \brief next index to be treated in each block
+    std::vector<std::atomic<size_type>> next;
+    //! \brief boolean stating if the treatment has been stopped
+    std::atomic<bool> stop{false};
+  };  // end of struct ParallelForState
+
+  /*!
+   * \brief add to the thread pool one task per block of the given state.
+   * \return the tasks
+   * \param[in,out] p: thread pool
+   * \param[in] s: shared state
+   * \param[in] t: function executed by each task. This function is called
+   * with the shared state, the index of the task and the index of the
+   * worker executing the task.
+   *
+   * \note the tasks hold a copy of the given function and share the
+   * ownership of the shared state, so that the tasks can outlive the caller.
+   * \note with the static scheduling policy, the task associated with the
+   * `i`th block is executed by the thread `i % n` of the pool, where `n` is
+   * the number of threads, unless this function is called by a thread of
+   * the pool. The integration points treated by a thread thus do not depend
+   * on the load of the other threads.
+   * \note if a task can't be added, the tasks already added are waited for
+   * before rethrowing the exception.
+   */
+  template <typename TaskFunction>
+  std::vector<std::future<ThreadedTaskResult<std::invoke_result_t<
+      TaskFunction&, ParallelForState&, size_type, size_type>>>>
+  launchParallelTasks(ThreadPool&,
+                      const std::shared_ptr<ParallelForState>&,
+                      const TaskFunction&);
+  /*!
+   * \brief wait for all the given tasks and rethrow the first exception
+   * thrown by one of them, if any.
+   * \return the results of the tasks
+   * \param[in] tasks: tasks
+   */
+  template <typename T>
+  std::vector<ThreadedTaskResult<T>> waitForParallelTasks(
+      std::vector<std::future<ThreadedTaskResult<T>>>&);
+
+}  // end of namespace mgis::internals
+
+namespace mgis {
+
+  /*!
+   * \brief distribute the treatment of a range of indices between the
+   * threads of a thread pool.
+   * \param[in,out] p: thread pool
+   * \param[in] blocks: boundaries of the blocks. One task is created per
+   * block. Those boundaries are typically computed by one of the
+   * partitioning functions declared in `MGIS/Partition.hxx`.
+   * \param[in] s: scheduling options
+   * \param[in] f: function treating a range of indices. This function takes
+   * the index of the worker as first argument and the boundaries of the
+   * range as second and third arguments. If this function returns a
+   * boolean, a false value stops the treatment: with the work-stealing
+   * scheduling policy, no chunk is claimed anymore.
+   *
+   * \note the index of the worker can be used to access data pre-allocated
+   * for each thread of the pool without synchronisation.
+   * \note this function returns once all tasks are finished. If some tasks
+   * have thrown an exception, the first one is rethrown.
+   */
+  template <typename Function>
+  void parallel_for(ThreadPool&,
+                    const std::vector<size_type>&,
+                    const SchedulingOptions&,
+                    const Function&);
+  /*!
+   * \brief distribute the treatment of the indices in the range `[0, n[`
+   * between the threads of a thread pool, using a uniform partition.
+   * \param[in,out] p: thread pool
+   * \param[in] n: number of indices
+   * \param[in] s: scheduling options
+   * \param[in] f: function treating a range of indices
+   */
+  template <typename Function>
+  void parallel_for(ThreadPool&,
+                    const size_type,
+                    const SchedulingOptions&,
+                    const Function&);
+  /*!
+   * \brief distribute the treatment of the indices in the range `[0, n[`
+   * between the threads of a thread pool, using a uniform partition and the
+   * static scheduling policy.
+   * \param[in,out] p: thread pool
+   * \param[in] n: number of indices
+   * \param[in] f: function treating a range of indices
+   */
+  template <typename Function>
+  void parallel_for(ThreadPool&, const size_type, const Function&);
+  /*!
+   * \brief distribute the treatment of a range of indices between the
+   * threads of a thread pool and reduce the results.
+   * \return the reduced value
+   * \param[in,out] p: thread pool
+   * \param[in] blocks: boundaries of the blocks
+   * \param[in] s: scheduling options
+   * \param[in] v: initial value, which must be the neutral element of the
+   * reduction
+   * \param[in] f: function treating a range of indices. This function takes
+   * the index of the worker as first argument and the boundaries of the
+   * range as second and third arguments.
+   * \param[in] r: reduction function, combining two values
+   *
+   * \note each task reduces the results of the chunks it treated. The
+   * results of the tasks are then reduced in the order of the blocks. The
+   * result is thus deterministic with the static scheduling policy.
+   */
+  template <typename T, typename Function, typename Reduce>
+  T parallel_reduce(ThreadPool&,
+                    const std::vector<size_type>&,
+                    const SchedulingOptions&,
+                    const T&,
+                    const Function&,
+                    const Reduce&);
+  /*!
+   * \brief distribute the treatment of the indices in the range `[0, n[`
+   * between the threads of a thread pool, using a uniform partition, and
+   * reduce the results.
+   * \return the reduced value
+   * \param[in,out] p: thread pool
+   * \param[in] n: number of indices
+   * \param[in] s: scheduling options
+   * \param[in] v: initial value
+   * \param[in] f: function treating a range of indices
+   * \param[in] r: reduction function
+   */
+  template <typename T, typename Function, typename Reduce>
+  T parallel_reduce(ThreadPool&,
+                    const size_type,
+                    const SchedulingOptions&,
+                    const T&,
+                    const Function&,
+                    const Reduce&);
+  /*!
+   * \brief distribute the treatment of the indices in the range `[0, n[`
+   * between the threads of a thread pool, using a uniform partition and the
+   * static scheduling policy, and reduce the results.
+   * \return the reduced value
+   * \param[in,out] p: thread pool
+   * \param[in] n: number of indices
+   * \param[in] v: initial value
+   * \param[in] f: function treating a range of indices
+   * \param[in] r: reduction function
+   */
+  template <typename T, typename Function, typename Reduce>
+  T parallel_reduce(
+      ThreadPool&, const size_type, const T&, const Function&, const Reduce&);
+
+}  // end of namespace mgis
+
+#include "MGIS/ParallelFor.ixx"
+
+#endif /* LIB_MGIS_PARALLELFOR_HXX */
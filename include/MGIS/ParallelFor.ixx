@@ -0,0 +1,194 @@
+/*!
+ * \file   include/MGIS/ParallelFor.ixx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_PARALLELFOR_IXX
+#define LIB_MGIS_PARALLELFOR_IXX
+
+#include <utility>
+#include <type_traits>
+
+namespace mgis::internals {
+
+  template <typename Function>
+  void ParallelForState::treat(const size_type i, const Function& f) {
+    const auto n = this->getNumberOfBlocks();
+    if (this->grain_size == 0) {
+      f(this->blocks[i], this->blocks[i + 1]);
+      return;
+    }
+    for (size_type j = 0; j != n; ++j) {
+      const auto k = (i + j) % n;
+      auto b = size_type{};
+      auto e = size_type{};
+      while (!this->stop.load(std::memory_order_relaxed)) {
+        if (!this->claim(b, e, k)) {
+          break;
+        }
+        if (!f(b, e)) {
+          this->stop.store(true, std::memory_order_relaxed);
+          return;
+        }
+      }
+    }
+  }  // end of treat
+
+  template <typename TaskFunction>
+  std::vector<std::future<ThreadedTaskResult<std::invoke_result_t<
+      TaskFunction&, ParallelForState&, size_type, size_type>>>>
+  launchParallelTasks(ThreadPool& p,
+                      const std::shared_ptr<ParallelForState>& s,
+                      const TaskFunction& t) {
+    using result = std::invoke_result_t<TaskFunction&, ParallelForState&,
+                                        size_type, size_type>;
+    const auto n = s->getNumberOfBlocks();
+    const auto nth = p.getNumberOfThreads();
+    // with the static scheduling policy, the `i`th block is always treated
+    // by the `i`th thread, unless the caller is itself a thread of the pool
+    // (which could then wait for a task that only itself can execute)
+    const auto pinned = (s->grain_size == 0) && (nth != 0) &&
+                        (!p.getCurrentWorkerIndex().has_value());
+    auto tasks = std::vector<std::future<ThreadedTaskResult<result>>>{};
+    tasks.reserve(n);
+    try {
+      for (size_type i = 0; i != n; ++i) {
+        auto task = [&p, s, t, i]() mutable {
+          return t(*s, i, p.getCurrentWorkerIndex().value());
+        };
+        if (pinned) {
+          tasks.push_back(p.addTaskToWorker(i % nth, std::move(task)));
+        } else {
+          tasks.push_back(p.addTask(std::move(task)));
+        }
+      }
+    } catch (...) {
+      for (auto& task : tasks) {
+        task.wait();
+      }
+      throw;
+    }
+    return tasks;
+  }  // end of launchParallelTasks
+
+  template <typename T>
+  std::vector<ThreadedTaskResult<T>> waitForParallelTasks(
+      std::vector<std::future<ThreadedTaskResult<T>>>& tasks) {
+    // all tasks are waited for before rethrowing an exception, so that no
+    // task is still running when the caller's data are destroyed
+    for (auto& t : tasks) {
+      t.wait();
+    }
+    auto results = std::vector<ThreadedTaskResult<T>>{};
+    results.reserve(tasks.size());
+    for (auto& t : tasks) {
+      results.push_back(t.get());
+    }
+    for (auto& r : results) {
+      if (!r) {
+        r.rethrow();
+      }
+    }
+    return results;
+  }  // end of waitForParallelTasks
+
+}  // end of namespace mgis::internals
+
+namespace mgis {
+
+  template <typename Function>
+  void parallel_for(ThreadPool& p,
+                    const std::vector<size_type>& blocks,
+                    const SchedulingOptions& s,
+                    const Function& f) {
+    using result = std::invoke_result_t<const Function&, size_type,
+                                        size_type, size_type>;
+    auto state = std::make_shared<internals::ParallelForState>(blocks, s);
+    auto tasks = internals::launchParallelTasks(
+        p, state,
+        [&f](internals::ParallelForState& st, const size_type i,
+             const size_type w) {
+          st.treat(i, [&f, w](const size_type b, const size_type e) {
+            if constexpr (std::is_same_v<result, bool>) {
+              return f(w, b, e);
+            } else {
+              f(w, b, e);
+              return true;
+            }
+          });
+        });
+    internals::waitForParallelTasks(tasks);
+  }  // end of parallel_for
+
+  template <typename Function>
+  void parallel_for(ThreadPool& p,
+                    const size_type n,
+                    const SchedulingOptions& s,
+                    const Function& f) {
+    parallel_for(p, getUniformPartition(n, p.getNumberOfThreads()), s, f);
+  }  // end of parallel_for
+
+  template <typename Function>
+  void parallel_for(ThreadPool& p, const size_type n, const Function& f) {
+    parallel_for(p, n, SchedulingOptions{}, f);
+  }  // end of parallel_for
+
+  template <typename T, typename Function, typename Reduce>
+  T parallel_reduce(ThreadPool& p,
+                    const std::vector<size_type>& blocks,
+                    const SchedulingOptions& s,
+                    const T& v,
+                    const Function& f,
+                    const Reduce& r) {
+    auto state = std::make_shared<internals::ParallelForState>(blocks, s);
+    auto tasks = internals::launchParallelTasks(
+        p, state,
+        [&v, &f, &r](internals::ParallelForState& st, const size_type i,
+                     const size_type w) {
+          auto tv = v;
+          st.treat(i, [&tv, &f, &r, w](const size_type b, const size_type e) {
+            tv = r(std::move(tv), f(w, b, e));
+            return true;
+          });
+          return tv;
+        });
+    auto results = internals::waitForParallelTasks(tasks);
+    auto rv = v;
+    for (auto& tr : results) {
+      rv = r(std::move(rv), std::move(*tr));
+    }
+    return rv;
+  }  // end of parallel_reduce
+
+  template <typename T, typename Function, typename Reduce>
+  T parallel_reduce(ThreadPool& p,
+                    const size_type n,
+                    const SchedulingOptions& s,
+                    const T& v,
+                    const Function& f,
+                    const Reduce& r) {
+    return parallel_reduce(p, getUniformPartition(n, p.getNumberOfThreads()),
+                           s, v, f, r);
+  }  // end of parallel_reduce
+
+  template <typename T, typename Function, typename Reduce>
+  T parallel_reduce(ThreadPool& p,
+                    const size_type n,
+                    const T& v,
+                    const Function& f,
+                    const Reduce& r) {
+    return parallel_reduce(p, n, SchedulingOptions{}, v, f, r);
+  }  // end of parallel_reduce
+
+}  // end of namespace mgis
+
+#endif /* LIB_MGIS_PARALLELFOR_IXX */
@@ -0,0 +1,54 @@
+/*!
+ * \file   include/MGIS/Partition.hxx
+ * \brief  This file declares functions used to split a range of indices in
+ * blocks treated by different threads.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_PARTITION_HXX
+#define LIB_MGIS_PARTITION_HXX
+
+#include <vector>
+#include "MGIS/Config.hxx"
+#include "MGIS/Span.hxx"
+
+namespace mgis {
+
+  /*!
+   * \brief split `n` indices in `nth` contiguous blocks of (almost) equal
+   * sizes.
+   * \return the boundaries of the blocks. The size of the returned vector is
+   * `nth + 1`.
+   * \param[in] n: number of indices
+   * \param[in] nth: number of blocks
+   *
+   * \note this partition is the one used by default by the multi-threaded
+   * functions treating the integration points of a material data manager.
+   */
+  MGIS_EXPORT std::vector<size_type> getUniformPartition(const size_type,
+                                                         const size_type);
+  /*!
+   * \brief split `n` indices in `nth` contiguous blocks of (almost) equal
+   * costs.
+   * \return the boundaries of the blocks. The size of the returned vector is
+   * `nth + 1`.
+   * \param[in] costs: cost of each index
+   * \param[in] nth: number of blocks
+   *
+   * \note if no cost is available, the indices are split in blocks of equal
+   * sizes.
+   */
+  MGIS_EXPORT std::vector<size_type> getCostBasedPartition(
+      mgis::span<const real>, const size_type);
+
+}  // end of namespace mgis
+
+#endif /* LIB_MGIS_PARTITION_HXX */
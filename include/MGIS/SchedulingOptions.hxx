@@ -0,0 +1,55 @@
+/*!
+ * \file   include/MGIS/SchedulingOptions.hxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_SCHEDULINGOPTIONS_HXX
+#define LIB_MGIS_SCHEDULINGOPTIONS_HXX
+
+#include "MGIS/Config.hxx"
+
+namespace mgis {
+
+  /*!
+   * \brief policy used to distribute a set of items (typically integration
+   * points) between the threads of a thread pool.
+   */
+  enum struct SchedulingPolicy {
+    /*!
+     * \brief the items are split in as many contiguous blocks as threads,
+     * each thread treating one block.
+     */
+    STATIC,
+    /*!
+     * \brief the items are split in as many contiguous blocks as threads.
+     * Each block is divided in chunks which are dynamically claimed by the
+     * threads: each thread first treats the chunks of its own block and
+     * then steals the chunks remaining in the other blocks.
+     */
+    WORK_STEALING
+  };  // end of enum struct SchedulingPolicy
+
+  //! \brief structure describing how a loop is distributed between threads
+  struct SchedulingOptions {
+    //! \brief scheduling policy
+    SchedulingPolicy policy = SchedulingPolicy::STATIC;
+    /*!
+     * \brief number of items per chunk. This value is only used by the
+     * `WORK_STEALING` policy. If null, the grain size is chosen so that each
+     * thread has about `16` chunks to treat.
+     */
+    size_type grain_size = 0;
+  };  // end of struct SchedulingOptions
+
+}  // end of namespace mgis
+
+#endif /* LIB_MGIS_SCHEDULINGOPTIONS_HXX */
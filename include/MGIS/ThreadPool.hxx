@@ -5,7 +5,9 @@
  * <https://github.com/progschj/ThreadPool>
  *
  * We added the possibility to handle exceptions through the
- * ThreadedTaskResult class.
+ * ThreadedTaskResult class. The central task queue of the initial
+ * implementation has been replaced by one queue per thread, with work
+ * stealing.
  *
  * \author Thomas Helfer
  * \date   24/08/2018
@@ -21,20 +23,35 @@
 #ifndef MGIS_THREAD_POOL_HXX
 #define MGIS_THREAD_POOL_HXX
 
-#include <queue>
+#include <deque>
 #include <mutex>
+#include <atomic>
+#include <memory>
 #include <vector>
 #include <thread>
 #include <future>
+#include <optional>
 #include <functional>
 #include <condition_variable>
 #include "MGIS/Config.hxx"
+#include "MGIS/ThreadPoolOptions.hxx"
 #include "MGIS/ThreadedTaskResult.hxx"
 
 namespace mgis {
 
   /*!
    * \brief structure handling a fixed-size pool of threads
+   *
+   * Each thread owns a queue of tasks. A task added by a thread of the pool
+   * is pushed in the queue of this thread. Tasks added by other threads are
+   * distributed among the queues in a round-robin manner. A thread first
+   * treats the tasks of its own queue, starting from the most recent one,
+   * and then steals the oldest tasks of the other queues. Tasks added to a
+   * given thread (see the `addTaskToWorker` method) are stored in a separate
+   * queue of this thread, which is treated first and is never stolen.
+   *
+   * Idle threads wait on a condition variable, which is only notified when
+   * some threads are idle, and only one thread is woken up per new task.
    */
   struct MGIS_EXPORT ThreadPool {
     /*!
@@ -42,6 +59,15 @@ namespace mgis {
      * \param[in] n: number of thread to be created
      */
     ThreadPool(const size_type);
+    /*!
+     * \brief constructor
+     * \param[in] n: number of thread to be created
+     * \param[in] o: options
+     *
+     * \note an exception is thrown if the threads can't be bound to the
+     * processors as requested by the affinity policy.
+     */
+    ThreadPool(const size_type, const ThreadPoolOptions&);
     /*!
      * \brief add a new task
      * \param[in] f: task
@@ -50,27 +76,131 @@ namespace mgis {
     template <typename F, typename... Args>
     std::future<ThreadedTaskResult<typename std::result_of<F(Args...)>::type>>
     addTask(F&&, Args&&...);
+    /*!
+     * \brief add a new task which is executed by the given thread.
+     * \param[in] i: index of the thread
+     * \param[in] f: task
+     * \param[in] a: arguments passed to the the task
+     *
+     * \note such a task is never stolen by the other threads. This allows
+     * to guarantee that data are always treated by the same thread, for
+     * instance to benefit from the first-touch policy of the operating
+     * systems on NUMA architectures.
+     */
+    template <typename F, typename... Args>
+    std::future<ThreadedTaskResult<typename std::result_of<F(Args...)>::type>>
+    addTaskToWorker(const size_type, F&&, Args&&...);
     //! \return the number of threads managed by the ppol
     size_type getNumberOfThreads() const;
+    /*!
+     * \return the index of the calling thread in the pool, if the calling
+     * thread is one of the threads managed by this pool.
+     *
+     * The index is lower than the number of threads managed by the pool. It
+     * can be used by a task to access data pre-allocated for each worker
+     * (workspaces, partial results, etc.) without any synchronisation.
+     *
+     * \note this method only reads a thread-local variable and is lock-free.
+     */
+    std::optional<size_type> getCurrentWorkerIndex() const;
+    /*!
+     * \return the processor to which the given worker is bound, if any.
+     * \param[in] i: index of the worker
+     */
+    std::optional<size_type> getWorkerCPU(const size_type) const;
+    /*!
+     * \return the NUMA node of the given worker, if known.
+     * \param[in] i: index of the worker
+     *
+     * \note the NUMA node is only known if the worker is bound to a
+     * processor and if the topology of the machine can be determined (see
+     * the `getNUMANode` function).
+     */
+    std::optional<size_type> getWorkerNUMANode(const size_type) const;
+    /*!
+     * \return the NUMA node of the calling thread, if the calling thread is
+     * one of the threads managed by this pool and if its NUMA node is known.
+     */
+    std::optional<size_type> getCurrentWorkerNUMANode() const;
     //! \brief wait for all tasks to be finished
     void wait();
     //! destructor
     ~ThreadPool();
 
    private:
+    //! \brief base class of the tasks stored in the queues
+    struct Task {
+      //! \brief execute the task
+      virtual void execute() = 0;
+      //! \brief destructor
+      virtual ~Task();
+    };
+    //! \brief implementation of a task
+    template <typename PackagedTask>
+    struct TaskImplementation;
+    //! \brief queue of tasks owned by a thread
+    struct TaskQueue {
+      //! \brief mutex protecting the queue
+      std::mutex m;
+      //! \brief tasks
+      std::deque<std::unique_ptr<Task>> tasks;
+      //! \brief tasks which can't be stolen by the other threads
+      std::deque<std::unique_ptr<Task>> pinned_tasks;
+      //! \brief number of tasks stored in `pinned_tasks`
+      std::atomic<size_type> number_of_pinned_tasks{0};
+    };
+    //! \brief main loop of a thread
+    void run(const size_type);
+    /*!
+     * \brief push a new task
+     * \param[in] t: task
+     */
+    void push(std::unique_ptr<Task>);
+    /*!
+     * \brief push a new task which can only be executed by the given thread
+     * \param[in] i: index of the thread
+     * \param[in] t: task
+     */
+    void pushToWorker(const size_type, std::unique_ptr<Task>);
+    /*!
+     * \return true if the given thread has a task to execute
+     * \param[in] i: index of the thread
+     */
+    bool hasTask(const size_type) const;
+    /*!
+     * \return the next task to be executed by the given thread, if any
+     * \param[in] i: index of the thread
+     */
+    std::unique_ptr<Task> pop(const size_type);
+    //! \brief stop and join all the threads
+    void stopWorkers();
     //! wrapper around the given task
     template <typename F>
     struct Wrapper;
-    enum Status { WORKING, IDLE };  // end of enum Status
-    std::vector<Status> statuses;
     //! list of threads
     std::vector<std::thread> workers;
-    // the task queue
-    std::queue<std::function<void()>> tasks;
-    // synchronization
+    //! \brief processors to which the threads are bound, if any
+    std::vector<std::optional<size_type>> workers_cpus;
+    //! \brief NUMA nodes of the threads, if known
+    std::vector<std::optional<size_type>> workers_numa_nodes;
+    //! \brief queues of tasks, one per thread
+    std::vector<std::unique_ptr<TaskQueue>> queues;
+    //! \brief number of tasks stored in the queues, excluding pinned tasks
+    std::atomic<size_type> number_of_queued_tasks{0};
+    //! \brief number of tasks added but not finished yet
+    std::atomic<size_type> number_of_unfinished_tasks{0};
+    //! \brief number of threads waiting for a task
+    std::atomic<size_type> number_of_idle_workers{0};
+    //! \brief index of the queue used by the next task added from outside
+    std::atomic<size_type> next_queue{0};
+    //! \brief mutex used to put idle threads to sleep
     std::mutex m;
+    //! \brief condition variable on which idle threads wait for tasks
     std::condition_variable c;
-    bool stop = false;
+    //! \brief condition variable used by the `wait` method
+    std::condition_variable finished;
+    //! \brief boolean stating if the threads shall stop
+    std::atomic<bool> stop{false};
   };
 
 }  // end of namespace mgis
@@ -59,27 +59,43 @@ namespace mgis {
     F f;
   };
 
+  template <typename PackagedTask>
+  struct ThreadPool::TaskImplementation final : ThreadPool::Task {
+    TaskImplementation(PackagedTask&& t_) : t(std::move(t_)) {}
+    void execute() override { this->t(); }
+    ~TaskImplementation() override = default;
+
+   private:
+    // packaged task
+    PackagedTask t;
+  };
+
   // add new work item to the pool
   template <typename F, typename... Args>
   std::future<ThreadedTaskResult<typename std::result_of<F(Args...)>::type>>
   ThreadPool::addTask(F&& f, Args&&... a) {
     using return_type =
         ThreadedTaskResult<typename std::result_of<F(Args...)>::type>;
-    using task = std::packaged_task<return_type()>;
-    auto t = std::make_shared<task>(
+    using packaged_task = std::packaged_task<return_type()>;
+    auto pt = packaged_task(
         std::bind(Wrapper<F>(std::forward<F>(f)), std::forward<Args>(a)...));
-    auto res = t->get_future();
-    {
-      std::unique_lock<std::mutex> lock(this->m);
-      // don't allow enqueueing after stopping the pool
-      if (this->stop) {
-        throw std::runtime_error(
-            "ThreadPool::addTask: "
-            "enqueue on stopped ThreadPool");
-      }
-      this->tasks.emplace([t] { (*t)(); });
-    }
-    this->c.notify_one();
+    auto res = pt.get_future();
+    this->push(
+        std::make_unique<TaskImplementation<packaged_task>>(std::move(pt)));
+    return res;
+  }
+
+  template <typename F, typename... Args>
+  std::future<ThreadedTaskResult<typename std::result_of<F(Args...)>::type>>
+  ThreadPool::addTaskToWorker(const size_type i, F&& f, Args&&... a) {
+    using return_type =
+        ThreadedTaskResult<typename std::result_of<F(Args...)>::type>;
+    using packaged_task = std::packaged_task<return_type()>;
+    auto pt = packaged_task(
+        std::bind(Wrapper<F>(std::forward<F>(f)), std::forward<Args>(a)...));
+    auto res = pt.get_future();
+    this->pushToWorker(
+        i, std::make_unique<TaskImplementation<packaged_task>>(std::move(pt)));
     return res;
   }
 
@@ -0,0 +1,53 @@
+/*!
+ * \file   include/MGIS/ThreadPoolOptions.hxx
+ * \brief  This file declares the options used to create a thread pool.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_THREADPOOLOPTIONS_HXX
+#define LIB_MGIS_THREADPOOLOPTIONS_HXX
+
+#include <vector>
+#include "MGIS/Config.hxx"
+
+namespace mgis {
+
+  //! \brief policy used to bind the threads of a thread pool to the cores
+  enum struct ThreadAffinityPolicy {
+    //! \brief the threads are not bound and may be migrated by the system
+    NO_AFFINITY,
+    /*!
+     * \brief the `i`th thread is bound to the `i`th processor available to
+     * the process (modulo the number of available processors), as returned
+     * by the `getAvailableCPUs` function.
+     */
+    ROUND_ROBIN,
+    /*!
+     * \brief the `i`th thread is bound to the `i`th processor of the list
+     * given by the user (modulo the size of this list).
+     */
+    CPU_LIST
+  };  // end of enum struct ThreadAffinityPolicy
+
+  //! \brief options used to create a thread pool
+  struct ThreadPoolOptions {
+    //! \brief affinity policy
+    ThreadAffinityPolicy affinity = ThreadAffinityPolicy::NO_AFFINITY;
+    /*!
+     * \brief list of processors used by the `CPU_LIST` affinity policy.
+     * This list is ignored by the other policies.
+     */
+    std::vector<size_type> cpus;
+  };  // end of struct ThreadPoolOptions
+
+}  // end of namespace mgis
+
+#endif /* LIB_MGIS_THREADPOOLOPTIONS_HXX */
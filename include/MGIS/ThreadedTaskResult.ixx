@@ -76,7 +76,7 @@ namespace mgis {
     if (this->eptr != nullptr) {
       this->rethrow();
     }
-    if (!this->result_has_value()) {
+    if (!this->result.has_value()) {
       ThreadedTaskResultBase::throwBadCastException();
     }
     return *(this->result);
@@ -111,7 +111,7 @@ namespace mgis {
   }  // end of ThreadedTaskResult<T>::setException
 
   template <typename T>
-  void ThreadedTaskResult<T>::rethrow() {
+  void ThreadedTaskResult<T>::rethrow() const {
     if (this->eptr == nullptr) {
       ThreadedTaskResultBase::throwNullException();
     }
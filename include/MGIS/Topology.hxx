@@ -0,0 +1,55 @@
+/*!
+ * \file   include/MGIS/Topology.hxx
+ * \brief  This file declares functions giving information on the topology
+ * of the machine (processors, NUMA nodes) and allowing to bind threads to
+ * processors.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_TOPOLOGY_HXX
+#define LIB_MGIS_TOPOLOGY_HXX
+
+#include <vector>
+#include <thread>
+#include <optional>
+#include "MGIS/Config.hxx"
+
+namespace mgis {
+
+  //! \return true if binding threads to processors is supported
+  MGIS_EXPORT bool isThreadAffinitySupported();
+  /*!
+   * \return the list of processors on which the calling thread is allowed
+   * to run. If this list can't be determined, the processors
+   * `0, ..., std::thread::hardware_concurrency() - 1` are returned.
+   */
+  MGIS_EXPORT std::vector<size_type> getAvailableCPUs();
+  /*!
+   * \return the NUMA node of the given processor, if known
+   * \param[in] cpu: processor
+   *
+   * \note on `Linux`, this information is read in the `sysfs` file system.
+   * It is not available on other systems.
+   */
+  MGIS_EXPORT std::optional<size_type> getNUMANode(const size_type);
+  /*!
+   * \brief bind the given thread to a processor
+   * \param[in] t: thread
+   * \param[in] cpu: processor
+   *
+   * \note an exception is thrown if the thread can't be bound to the
+   * processor.
+   */
+  MGIS_EXPORT void bindThreadToCPU(std::thread&, const size_type);
+
+}  // end of namespace mgis
+
+#endif /* LIB_MGIS_TOPOLOGY_HXX */
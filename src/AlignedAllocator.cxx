@@ -0,0 +1,62 @@
+/*!
+ * \file   src/AlignedAllocator.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <new>
+#include <cstdlib>
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+#include <malloc.h>
+#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
+#ifdef __linux__
+#include <sys/mman.h>
+#endif /* __linux__ */
+#include "MGIS/AlignedAllocator.hxx"
+
+namespace mgis {
+
+  void* allocateAlignedMemory(const std::size_t s) {
+    if (s == 0) {
+      return nullptr;
+    }
+    const auto a = (s >= huge_page_size) ? huge_page_size : cache_line_size;
+    // the size must be a multiple of the alignment
+    const auto as = ((s + a - 1) / a) * a;
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+    auto* const p = ::_aligned_malloc(as, a);
+#else  /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
+    void* p = nullptr;
+    if (::posix_memalign(&p, a, as) != 0) {
+      p = nullptr;
+    }
+#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
+    if (p == nullptr) {
+      throw(std::bad_alloc());
+    }
+#if defined __linux__ && defined MADV_HUGEPAGE
+    if (a == huge_page_size) {
+      // this is only an advice, failure is not an error
+      ::madvise(p, as, MADV_HUGEPAGE);
+    }
+#endif /* defined __linux__ && defined MADV_HUGEPAGE */
+    return p;
+  }  // end of allocateAlignedMemory
+
+  void freeAlignedMemory(void* const p) noexcept {
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+    ::_aligned_free(p);
+#else  /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
+    std::free(p);
+#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
+  }  // end of freeAlignedMemory
+
+}  // end of namespace mgis
@@ -12,13 +12,18 @@
  *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
  */
 
+#include <map>
+#include <mutex>
+#include <tuple>
 #include <cstdlib>
 #include <iterator>
 
 #include "MGIS/Raise.hxx"
+#include "MGIS/ParallelFor.hxx"
 #include "MGIS/LibrariesManager.hxx"
 #include "MGIS/Behaviour/Hypothesis.hxx"
 #include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/PersistentBehaviourCache.hxx"
 
 namespace mgis::behaviour {
 
@@ -126,6 +131,16 @@ namespace mgis::behaviour {
   Behaviour &Behaviour::operator=(const Behaviour &) = default;
   Behaviour::~Behaviour() = default;
 
+  void updateVariablesIndexes(Behaviour &b) {
+    const auto h = b.hypothesis;
+    b.gradients_index = buildVariablesIndex(b.gradients, h);
+    b.thermodynamic_forces_index =
+        buildVariablesIndex(b.thermodynamic_forces, h);
+    b.mps_index = buildVariablesIndex(b.mps, h);
+    b.isvs_index = buildVariablesIndex(b.isvs, h);
+    b.esvs_index = buildVariablesIndex(b.esvs, h);
+  }  // end of updateVariablesIndexes
+
   bool isStandardFiniteStrainBehaviour(const std::string &l,
                                        const std::string &b) {
     auto &lm = mgis::LibrariesManager::get();
@@ -133,9 +148,9 @@ namespace mgis::behaviour {
            (lm.getBehaviourKinematic(l, b) == 3);
   }  // end of isStandardFiniteStrainBehaviour
 
-  static Behaviour load_behaviour(const std::string &l,
-                                  const std::string &b,
-                                  const Hypothesis h) {
+  static Behaviour load_behaviour_from_library(const std::string &l,
+                                               const std::string &b,
+                                               const Hypothesis h) {
     auto &lm = mgis::LibrariesManager::get();
     const auto fct = b + '_' + toString(h);
     auto raise = [&b, &l](const std::string &msg) {
@@ -387,11 +402,102 @@ namespace mgis::behaviour {
       d.postprocessings.insert({i, pfct});
     }
     return d;
+  }  // end of load_behaviour_from_library
+
+  static Behaviour load_behaviour(const std::string &l,
+                                  const std::string &b,
+                                  const Hypothesis h) {
+    if (!isPersistentBehaviourCacheUsed()) {
+      return load_behaviour_from_library(l, b, h);
+    }
+    const auto k = internals::getPersistentBehaviourCacheKey(l, b);
+    if (!k) {
+      return load_behaviour_from_library(l, b, h);
+    }
+    auto od = internals::readPersistentBehaviourCache(*k, b, h);
+    if (!od) {
+      auto d = load_behaviour_from_library(l, b, h);
+      internals::writePersistentBehaviourCache(*k, d);
+      return d;
+    }
+    // only the function pointers are retrieved from the library
+    auto &lm = mgis::LibrariesManager::get();
+    auto &d = *od;
+    d.library = l;
+    d.b = lm.getBehaviour(l, b, h);
+    for (auto &[n, f] : d.initialize_functions) {
+      f.f = lm.getBehaviourInitializeFunction(l, b, n, h);
+    }
+    for (auto &[n, p] : d.postprocessings) {
+      p.f = lm.getBehaviourPostProcessing(l, b, n, h);
+    }
+    return d;
   }  // end of load_behaviour
 
-  Behaviour load(const std::string &l,
-                 const std::string &b,
-                 const Hypothesis h) {
+  /*!
+   * \brief key of the cache of behaviours: library, behaviour, modelling
+   * hypothesis, stress measure and tangent operator. The last two members
+   * are negative for behaviours loaded without finite strain options.
+   */
+  using BehaviourCacheKey =
+      std::tuple<std::string, std::string, Hypothesis, int, int>;
+
+  //! \brief cache of the behaviours already loaded
+  struct BehaviourCache {
+    //! \brief mutex protecting the cache
+    std::mutex m;
+    //! \brief loaded behaviours
+    std::map<BehaviourCacheKey, Behaviour> behaviours;
+  };  // end of struct BehaviourCache
+
+  //! \return the cache of the behaviours already loaded
+  static BehaviourCache &getBehaviourCache() {
+    static BehaviourCache cache;
+    return cache;
+  }  // end of getBehaviourCache
+
+  /*!
+   * \return the behaviour associated with the given key. The behaviour is
+   * built by the given function if it is not in the cache.
+   * \param[in] k: key
+   * \param[in] f: function building the behaviour
+   *
+   * \note the function building the behaviour is called without holding
+   * the lock of the cache. The behaviours which could not be loaded are not
+   * cached.
+   */
+  template <typename BehaviourLoader>
+  static Behaviour getCachedBehaviour(const BehaviourCacheKey &k,
+                                      const BehaviourLoader &f) {
+    auto &cache = getBehaviourCache();
+    {
+      std::lock_guard<std::mutex> lock(cache.m);
+      const auto p = cache.behaviours.find(k);
+      if (p != cache.behaviours.end()) {
+        return p->second;
+      }
+    }
+    auto d = f();
+    std::lock_guard<std::mutex> lock(cache.m);
+    cache.behaviours.insert({k, d});
+    return d;
+  }  // end of getCachedBehaviour
+
+  mgis::size_type getBehaviourCacheSize() {
+    auto &cache = getBehaviourCache();
+    std::lock_guard<std::mutex> lock(cache.m);
+    return static_cast<mgis::size_type>(cache.behaviours.size());
+  }  // end of getBehaviourCacheSize
+
+  void clearBehaviourCache() {
+    auto &cache = getBehaviourCache();
+    std::lock_guard<std::mutex> lock(cache.m);
+    cache.behaviours.clear();
+  }  // end of clearBehaviourCache
+
+  static Behaviour load_uncached(const std::string &l,
+                                 const std::string &b,
+                                 const Hypothesis h) {
     if (isStandardFiniteStrainBehaviour(l, b)) {
       mgis::raise(
           "mgis::behaviour::load: "
@@ -429,13 +535,14 @@ namespace mgis::behaviour {
             lm.getRotateArrayOfBehaviourTangentOperatorBlocksFunction(l, b, h);
       }
     }
+    updateVariablesIndexes(d);
     return d;
-  }  // end of load
+  }  // end of load_uncached
 
-  Behaviour load(const FiniteStrainBehaviourOptions &o,
-                 const std::string &l,
-                 const std::string &b,
-                 const Hypothesis h) {
+  static Behaviour load_uncached(const FiniteStrainBehaviourOptions &o,
+                                 const std::string &l,
+                                 const std::string &b,
+                                 const Hypothesis h) {
     auto d = load_behaviour(l, b, h);
     if (d.btype != Behaviour::STANDARDFINITESTRAINBEHAVIOUR) {
       mgis::raise(
@@ -491,7 +598,106 @@ namespace mgis::behaviour {
           lm.getRotateArrayOfBehaviourTangentOperatorBlocksFunction(
               l, b, h, o.tangent_operator);
     }
+    updateVariablesIndexes(d);
     return d;
+  }  // end of load_uncached
+
+  Behaviour load(const std::string &l,
+                 const std::string &b,
+                 const Hypothesis h) {
+    return getCachedBehaviour({l, b, h, -1, -1},
+                              [&l, &b, h] { return load_uncached(l, b, h); });
+  }  // end of load
+
+  Behaviour load(const FiniteStrainBehaviourOptions &o,
+                 const std::string &l,
+                 const std::string &b,
+                 const Hypothesis h) {
+    const auto k =
+        BehaviourCacheKey{l, b, h, static_cast<int>(o.stress_measure),
+                          static_cast<int>(o.tangent_operator)};
+    return getCachedBehaviour(
+        k, [&o, &l, &b, h] { return load_uncached(o, l, b, h); });
+  }  // end of load
+
+  static BehaviourCacheKey getBehaviourCacheKey(const BehaviourLoadRequest &r) {
+    if (!r.options) {
+      return {r.library, r.behaviour, r.hypothesis, -1, -1};
+    }
+    return {r.library, r.behaviour, r.hypothesis,
+            static_cast<int>(r.options->stress_measure),
+            static_cast<int>(r.options->tangent_operator)};
+  }  // end of getBehaviourCacheKey
+
+  std::vector<ThreadedTaskResult<Behaviour>> load(
+      mgis::ThreadPool &p, const std::vector<BehaviourLoadRequest> &requests) {
+    using size_type = std::vector<BehaviourLoadRequest>::size_type;
+    auto &lm = mgis::LibrariesManager::get();
+    auto results = std::vector<ThreadedTaskResult<Behaviour>>(requests.size());
+    // libraries, each one being associated with the exception thrown while
+    // opening it, if any
+    auto libraries = std::map<std::string, ThreadedTaskResult<void>>{};
+    // unique requests, each one being associated with the index of its
+    // first occurence
+    auto indexes = std::map<BehaviourCacheKey, size_type>{};
+    auto unique_requests = std::vector<size_type>{};
+    for (size_type i = 0; i != requests.size(); ++i) {
+      libraries.insert({requests[i].library, ThreadedTaskResult<void>{}});
+      if (indexes.insert({getBehaviourCacheKey(requests[i]), i}).second) {
+        unique_requests.push_back(i);
+      }
+    }
+    // opening the libraries
+    auto plibraries = std::vector<decltype(libraries)::iterator>{};
+    for (auto pl = libraries.begin(); pl != libraries.end(); ++pl) {
+      plibraries.push_back(pl);
+    }
+    mgis::parallel_for(
+        p, static_cast<mgis::size_type>(plibraries.size()),
+        [&lm, &plibraries](const mgis::size_type, const mgis::size_type b,
+                           const mgis::size_type e) {
+          for (auto i = b; i != e; ++i) {
+            try {
+              lm.preloadLibrary(plibraries[i]->first);
+            } catch (...) {
+              plibraries[i]->second.setException(std::current_exception());
+            }
+          }
+        });
+    // loading the behaviours
+    mgis::parallel_for(
+        p, static_cast<mgis::size_type>(unique_requests.size()),
+        [&requests, &results, &libraries, &unique_requests](
+            const mgis::size_type, const mgis::size_type b,
+            const mgis::size_type e) {
+          for (auto i = b; i != e; ++i) {
+            const auto idx = unique_requests[i];
+            const auto &r = requests[idx];
+            auto &result = results[idx];
+            try {
+              auto &lr = libraries.at(r.library);
+              if (!lr) {
+                lr.rethrow();
+              }
+              if (r.options) {
+                result = load(*(r.options), r.library, r.behaviour,
+                              r.hypothesis);
+              } else {
+                result = load(r.library, r.behaviour, r.hypothesis);
+              }
+            } catch (...) {
+              result.setException(std::current_exception());
+            }
+          }
+        });
+    // duplicated requests
+    for (size_type i = 0; i != requests.size(); ++i) {
+      const auto idx = indexes.at(getBehaviourCacheKey(requests[i]));
+      if (idx != i) {
+        results[i] = results[idx];
+      }
+    }
+    return results;
   }  // end of load
 
   mgis::size_type getTangentOperatorArraySize(const Behaviour &b) {
@@ -599,7 +805,8 @@ namespace mgis::behaviour {
                        const mgis::span<const real> &gg,
                        const mgis::span<const real> &r) {
     checkBehaviourRotateGradients(b);
-    const auto gsize = getArraySize(b.gradients, b.hypothesis);
+    const auto gsize =
+        getArraySize(b.gradients, b.gradients_index, b.hypothesis);
     const auto nipts =
         checkRotateFunctionInputs("rotateGradients", mg, gg, gsize);
     if (r.size() == 0) {
@@ -632,7 +839,8 @@ namespace mgis::behaviour {
                        const mgis::span<const real> &gg,
                        const RotationMatrix2D &r) {
     checkBehaviourRotateGradients(b);
-    const auto gsize = getArraySize(b.gradients, b.hypothesis);
+    const auto gsize =
+        getArraySize(b.gradients, b.gradients_index, b.hypothesis);
     const auto nipts =
         checkRotateFunctionInputs("rotateGradients", mg, gg, gsize);
     checkRotationMatrix2D("rotateGradients", r, b, nipts);
@@ -653,7 +861,8 @@ namespace mgis::behaviour {
                        const mgis::span<const real> &gg,
                        const RotationMatrix3D &r) {
     checkBehaviourRotateGradients(b);
-    const auto gsize = getArraySize(b.gradients, b.hypothesis);
+    const auto gsize =
+        getArraySize(b.gradients, b.gradients_index, b.hypothesis);
     const auto nipts =
         checkRotateFunctionInputs("rotateGradients", mg, gg, gsize);
     checkRotationMatrix3D("rotateGradients", r, b, nipts);
@@ -704,7 +913,8 @@ namespace mgis::behaviour {
                                  const mgis::span<const real> &mtf,
                                  const mgis::span<const real> &r) {
     checkBehaviourRotateThermodynamicForces(b);
-    const auto tfsize = getArraySize(b.thermodynamic_forces, b.hypothesis);
+    const auto tfsize = getArraySize(
+        b.thermodynamic_forces, b.thermodynamic_forces_index, b.hypothesis);
     const auto nipts = checkRotateFunctionInputs("rotateThermodynamicForces",
                                                  mtf, gtf, tfsize);
     if (r.size() == 0) {
@@ -743,7 +953,8 @@ namespace mgis::behaviour {
                                  const mgis::span<const real> &mtf,
                                  const RotationMatrix2D &r) {
     checkBehaviourRotateThermodynamicForces(b);
-    const auto tfsize = getArraySize(b.thermodynamic_forces, b.hypothesis);
+    const auto tfsize = getArraySize(
+        b.thermodynamic_forces, b.thermodynamic_forces_index, b.hypothesis);
     const auto nipts = checkRotateFunctionInputs("rotateThermodynamicForces",
                                                  gtf, mtf, tfsize);
     checkRotationMatrix2D("rotateThermodynamicForces", r, b, nipts);
@@ -766,7 +977,8 @@ namespace mgis::behaviour {
                                  const mgis::span<const real> &mtf,
                                  const RotationMatrix3D &r) {
     checkBehaviourRotateThermodynamicForces(b);
-    const auto tfsize = getArraySize(b.thermodynamic_forces, b.hypothesis);
+    const auto tfsize = getArraySize(
+        b.thermodynamic_forces, b.thermodynamic_forces_index, b.hypothesis);
     const auto nipts = checkRotateFunctionInputs("rotateThermodynamicForces",
                                                  gtf, mtf, tfsize);
     checkRotationMatrix3D("rotateThermodynamicForces", r, b, nipts);
@@ -904,6 +1116,110 @@ namespace mgis::behaviour {
     }
   }  // end of rotateTangentOperatorBlocks
 
+  /*!
+   * \brief distribute the rotation of an array of values between the threads
+   * of a thread pool. Each task calls the given sequential rotation function
+   * on the sub-arrays associated with a block of integration points.
+   * \param[in,out] p: thread pool
+   * \param[out] o: values in the output frame
+   * \param[in] i: values in the input frame
+   * \param[in] r: rotation matrices
+   * \param[in] vsize: number of values per integration point
+   * \param[in] f: sequential rotation function
+   *
+   * \note if the arguments are inconsistent, the sequential rotation
+   * function is called on the whole arrays to report the error.
+   */
+  template <typename RotationFunction>
+  static void rotateInParallel(mgis::ThreadPool &p,
+                               mgis::span<real> o,
+                               const mgis::span<const real> &i,
+                               const mgis::span<const real> &r,
+                               const size_type vsize,
+                               const RotationFunction &f) {
+    const auto isize = static_cast<size_type>(i.size());
+    const auto rsize = static_cast<size_type>(r.size());
+    const auto nipts = (vsize == 0) ? size_type{0} : isize / vsize;
+    if ((nipts == 0) || (isize != nipts * vsize) ||
+        (static_cast<size_type>(o.size()) != isize) ||
+        ((rsize != 9) && (rsize != 9 * nipts))) {
+      f(o, i, r);
+      return;
+    }
+    mgis::parallel_for(p, nipts, [&o, &i, &r, &f, vsize, rsize](
+                                     const size_type, const size_type b,
+                                     const size_type e) {
+      if (b == e) {
+        return;
+      }
+      const auto n = e - b;
+      f(o.subspan(b * vsize, n * vsize), i.subspan(b * vsize, n * vsize),
+        (rsize == 9) ? r : r.subspan(9 * b, 9 * n));
+    });
+  }  // end of rotateInParallel
+
+  void rotateGradients(mgis::ThreadPool &p,
+                       mgis::span<real> g,
+                       const Behaviour &b,
+                       const mgis::span<const real> &r) {
+    rotateGradients(p, g, b, g, r);
+  }  // end of rotateGradients
+
+  void rotateGradients(mgis::ThreadPool &p,
+                       mgis::span<real> mg,
+                       const Behaviour &b,
+                       const mgis::span<const real> &gg,
+                       const mgis::span<const real> &r) {
+    const auto gsize =
+        getArraySize(b.gradients, b.gradients_index, b.hypothesis);
+    rotateInParallel(p, mg, gg, r, gsize,
+                     [&b](mgis::span<real> o, mgis::span<const real> i,
+                          mgis::span<const real> ri) {
+                       rotateGradients(o, b, i, ri);
+                     });
+  }  // end of rotateGradients
+
+  void rotateThermodynamicForces(mgis::ThreadPool &p,
+                                 mgis::span<real> tf,
+                                 const Behaviour &b,
+                                 const mgis::span<const real> &r) {
+    rotateThermodynamicForces(p, tf, b, tf, r);
+  }  // end of rotateThermodynamicForces
+
+  void rotateThermodynamicForces(mgis::ThreadPool &p,
+                                 mgis::span<real> gtf,
+                                 const Behaviour &b,
+                                 const mgis::span<const real> &mtf,
+                                 const mgis::span<const real> &r) {
+    rotateInParallel(
+        p, gtf, mtf, r,
+        getArraySize(b.thermodynamic_forces, b.thermodynamic_forces_index,
+                     b.hypothesis),
+        [&b](mgis::span<real> o, mgis::span<const real> i,
+             mgis::span<const real> ri) {
+          rotateThermodynamicForces(o, b, i, ri);
+        });
+  }  // end of rotateThermodynamicForces
+
+  void rotateTangentOperatorBlocks(mgis::ThreadPool &p,
+                                   mgis::span<real> K,
+                                   const Behaviour &b,
+                                   const mgis::span<const real> &r) {
+    rotateTangentOperatorBlocks(p, K, b, K, r);
+  }  // end of rotateTangentOperatorBlocks
+
+  void rotateTangentOperatorBlocks(mgis::ThreadPool &p,
+                                   mgis::span<real> gK,
+                                   const Behaviour &b,
+                                   const mgis::span<const real> &mK,
+                                   const mgis::span<const real> &r) {
+    rotateInParallel(p, gK, mK, r, getTangentOperatorArraySize(b),
+                     [&b](mgis::span<real> o, mgis::span<const real> i,
+                          mgis::span<const real> ri) {
+                       rotateTangentOperatorBlocks(o, b, i, ri);
+                     });
+  }  // end of rotateTangentOperatorBlocks
+
   void setParameter(const Behaviour &b, const std::string &n, const double v) {
     auto &lm = mgis::LibrariesManager::get();
     lm.setParameter(b.library, b.behaviour, b.hypothesis, n, v);
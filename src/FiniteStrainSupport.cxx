@@ -16,6 +16,7 @@
 #include "MGIS/Behaviour/Hypothesis.hxx"
 #include "MGIS/Behaviour/Behaviour.hxx"
 #include "MGIS/Behaviour/BehaviourData.hxx"
+#include "MGIS/ParallelFor.hxx"
 #include "MGIS/Behaviour/MaterialDataManager.hxx"
 #include "MGIS/Behaviour/FiniteStrainSupport.hxx"
 
@@ -113,8 +114,10 @@ namespace mgis::behaviour {
     }
   }  // end of convertFiniteStrainStress_PK1_3D
 
+  template <typename Loop>
   static void convertFiniteStrainStress_PK1_2D(mgis::span<real>& s,
-                                               const MaterialDataManager& m) {
+                                               const MaterialDataManager& m,
+                                               const Loop& loop) {
     // check behaviour type
     if (m.b.btype != Behaviour::STANDARDFINITESTRAINBEHAVIOUR) {
       mgis::raise(
@@ -129,11 +132,15 @@ namespace mgis::behaviour {
           "convertFiniteStrainStress: "
           "unsupported tangent operator");
     }
-    convertFiniteStrainStress_PK1_2D(s, m, 0, m.n);
+    loop([&s, &m](const mgis::size_type b, const mgis::size_type e) {
+      convertFiniteStrainStress_PK1_2D(s, m, b, e);
+    });
   }  // end of convertFiniteStrainStress_PK1_2D
 
+  template <typename Loop>
   static void convertFiniteStrainStress_PK1_3D(mgis::span<real>& s,
-                                               const MaterialDataManager& m) {
+                                               const MaterialDataManager& m,
+                                               const Loop& loop) {
     // check behaviour type
     if (m.b.btype != Behaviour::STANDARDFINITESTRAINBEHAVIOUR) {
       mgis::raise(
@@ -148,20 +155,37 @@ namespace mgis::behaviour {
           "convertFiniteStrainStress: "
           "unsupported tangent operator");
     }
-    convertFiniteStrainStress_PK1_3D(s, m, 0, m.n);
+    loop([&s, &m](const mgis::size_type b, const mgis::size_type e) {
+      convertFiniteStrainStress_PK1_3D(s, m, b, e);
+    });
   }  // end of convertFiniteStrainStress_PK1_3D
 
-  void convertFiniteStrainStress(mgis::span<real>& s,
-                                 const MaterialDataManager& m,
-                                 const FiniteStrainStress t) {
+  /*!
+   * \brief convert the stress for all the integration points of a material
+   * data manager.
+   * \param[out] s: new stress
+   * \param[in] m: material data manager
+   * \param[in] t: expected finite strain stress type
+   * \param[in] loop: function distributing the integration points
+   */
+  template <typename Loop>
+  static void convertFiniteStrainStress(mgis::span<real>& s,
+                                        const MaterialDataManager& m,
+                                        const FiniteStrainStress t,
+                                        const Loop& loop) {
     const auto h = m.b.hypothesis;
+    if (m.s1.precision != StateStoragePrecision::DOUBLE_PRECISION) {
+      mgis::raise(
+          "convertFiniteStrainStress: "
+          "the single precision storage mode is not supported");
+    }
     if (t == FiniteStrainStress::PK1) {
       if (h == Hypothesis::TRIDIMENSIONAL) {
-        convertFiniteStrainStress_PK1_3D(s, m);
+        convertFiniteStrainStress_PK1_3D(s, m, loop);
       } else if ((h == Hypothesis::AXISYMMETRICAL) ||
                  (h == Hypothesis::PLANESTRAIN) ||
                  (h == Hypothesis::GENERALISEDPLANESTRAIN)) {
-        convertFiniteStrainStress_PK1_2D(s, m);
+        convertFiniteStrainStress_PK1_2D(s, m, loop);
       } else {
         mgis::raise(
             "convertFiniteStrainStress: "
@@ -174,6 +198,23 @@ namespace mgis::behaviour {
     }
   }  // end of convertFiniteStrainStress
 
+  void convertFiniteStrainStress(mgis::span<real>& s,
+                                 const MaterialDataManager& m,
+                                 const FiniteStrainStress t) {
+    convertFiniteStrainStress(s, m, t, [&m](const auto& f) { f(0, m.n); });
+  }  // end of convertFiniteStrainStress
+
+  void convertFiniteStrainStress(mgis::ThreadPool& p,
+                                 mgis::span<real>& s,
+                                 const MaterialDataManager& m,
+                                 const FiniteStrainStress t) {
+    convertFiniteStrainStress(s, m, t, [&p, &m](const auto& f) {
+      mgis::parallel_for(p, m.n,
+                         [&f](const mgis::size_type, const mgis::size_type b,
+                              const mgis::size_type e) { f(b, e); });
+    });
+  }  // end of convertFiniteStrainStress
+
   static void convertFiniteStrainStress_PK1_2D(mgis::span<real>& P,
                                                const BehaviourData& d) {
     // check behaviour type
@@ -751,8 +792,11 @@ namespace mgis::behaviour {
     }
   }  // end of convertFiniteStrainTangentOperator_PK1_3D
 
+  template <typename Loop>
   static void convertFiniteStrainTangentOperator_PK1_2D(
-      mgis::span<mgis::real>& K, const MaterialDataManager& m) {
+      mgis::span<mgis::real>& K,
+      const MaterialDataManager& m,
+      const Loop& loop) {
     // check behaviour type
     if (m.b.btype != Behaviour::STANDARDFINITESTRAINBEHAVIOUR) {
       mgis::raise(
@@ -769,11 +813,16 @@ namespace mgis::behaviour {
           "convertFiniteStrainTangentOperator: "
           "unsupported tangent operator");
     }
-    convertFiniteStrainTangentOperator_PK1_2D(K, m, 0, m.n);
+    loop([&K, &m](const mgis::size_type b, const mgis::size_type e) {
+      convertFiniteStrainTangentOperator_PK1_2D(K, m, b, e);
+    });
   }  // end of convertFiniteStrainTangentOperator_PK1_2D
 
+  template <typename Loop>
   static void convertFiniteStrainTangentOperator_PK1_3D(
-      mgis::span<mgis::real>& K, const MaterialDataManager& m) {
+      mgis::span<mgis::real>& K,
+      const MaterialDataManager& m,
+      const Loop& loop) {
     // check behaviour type
     if (m.b.btype != Behaviour::STANDARDFINITESTRAINBEHAVIOUR) {
       mgis::raise(
@@ -790,20 +839,38 @@ namespace mgis::behaviour {
           "convertFiniteStrainTangentOperator: "
           "unsupported tangent operator");
     }
-    convertFiniteStrainTangentOperator_PK1_3D(K, m, 0, m.n);
+    loop([&K, &m](const mgis::size_type b, const mgis::size_type e) {
+      convertFiniteStrainTangentOperator_PK1_3D(K, m, b, e);
+    });
   }  // end of convertFiniteStrainTangentOperator_PK1_3D
 
-  void convertFiniteStrainTangentOperator(mgis::span<mgis::real>& K,
-                                          const MaterialDataManager& m,
-                                          const FiniteStrainTangentOperator t) {
+  /*!
+   * \brief convert the tangent operator for all the integration points of a
+   * material data manager.
+   * \param[out] K: new tangent operator
+   * \param[in] m: material data manager
+   * \param[in] t: expected finite strain operator type
+   * \param[in] loop: function distributing the integration points
+   */
+  template <typename Loop>
+  static void convertFiniteStrainTangentOperator(
+      mgis::span<mgis::real>& K,
+      const MaterialDataManager& m,
+      const FiniteStrainTangentOperator t,
+      const Loop& loop) {
     const auto h = m.b.hypothesis;
+    if (m.s1.precision != StateStoragePrecision::DOUBLE_PRECISION) {
+      mgis::raise(
+          "convertFiniteStrainTangentOperator: "
+          "the single precision storage mode is not supported");
+    }
     if (t == FiniteStrainTangentOperator::DPK1_DF) {
       if (h == Hypothesis::TRIDIMENSIONAL) {
-        convertFiniteStrainTangentOperator_PK1_3D(K, m);
+        convertFiniteStrainTangentOperator_PK1_3D(K, m, loop);
       } else if ((h == Hypothesis::AXISYMMETRICAL) ||
                  (h == Hypothesis::PLANESTRAIN) ||
                  (h == Hypothesis::GENERALISEDPLANESTRAIN)) {
-        convertFiniteStrainTangentOperator_PK1_2D(K, m);
+        convertFiniteStrainTangentOperator_PK1_2D(K, m, loop);
       } else {
         mgis::raise(
             "convertFiniteStrainTangentOperator: "
@@ -816,6 +883,24 @@ namespace mgis::behaviour {
     }
   }  // end of convertFiniteStrainTangentOperator
 
+  void convertFiniteStrainTangentOperator(mgis::span<mgis::real>& K,
+                                          const MaterialDataManager& m,
+                                          const FiniteStrainTangentOperator t) {
+    convertFiniteStrainTangentOperator(K, m, t,
+                                       [&m](const auto& f) { f(0, m.n); });
+  }  // end of convertFiniteStrainTangentOperator
+
+  void convertFiniteStrainTangentOperator(mgis::ThreadPool& p,
+                                          mgis::span<mgis::real>& K,
+                                          const MaterialDataManager& m,
+                                          const FiniteStrainTangentOperator t) {
+    convertFiniteStrainTangentOperator(K, m, t, [&p, &m](const auto& f) {
+      mgis::parallel_for(p, m.n,
+                         [&f](const mgis::size_type, const mgis::size_type b,
+                              const mgis::size_type e) { f(b, e); });
+    });
+  }  // end of convertFiniteStrainTangentOperator
+
   static void convertFiniteStrainTangentOperator_PK1_2D(
       mgis::span<mgis::real>& K, const BehaviourData& d) {
     // check behaviour type
@@ -0,0 +1,165 @@
+/*!
+ * \file   src/GatherPlan.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <map>
+#include <string>
+#include "MGIS/Raise.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/GatherPlan.hxx"
+
+namespace mgis::behaviour {
+
+  static VariablesGatherPlan buildVariablesGatherPlan(
+      const std::map<std::string, MaterialStateManager::FieldHolder>& values,
+      const MaterialDataManager& m,
+      const std::vector<Variable>& ds) {
+    auto p = VariablesGatherPlan{};
+    auto offset = mgis::size_type{};
+    for (const auto& d : ds) {
+      const auto s = getVariableSize(d, m.b.hypothesis);
+      const auto pv = values.find(d.name);
+      if (pv == values.end()) {
+        auto msg = std::string{"buildGatherPlan: no variable named '" +
+                               d.name + "' declared"};
+        if (!values.empty()) {
+          msg += "\nThe following variables were declared: ";
+          for (const auto& variable : values) {
+            msg += "\n- " + variable.first;
+          }
+        } else {
+          msg += "\nNo variable declared.";
+        }
+        mgis::raise(msg);
+      }
+      auto add_operation = [&p, offset, s](const real* const v,
+                                           const size_type vs) {
+        if (vs == s) {
+          // uniform value
+          p.uniform_variables.push_back({offset, s, v, 0});
+        } else {
+          p.variable_variables.push_back({offset, s, v, s});
+        }
+      };
+      if (std::holds_alternative<real>(pv->second)) {
+        if (d.type != Variable::SCALAR) {
+          mgis::raise(
+              "buildGatherPlan: invalid type for "
+              "variable '" +
+              d.name + "'");
+        }
+        add_operation(&(std::get<real>(pv->second)), 1);
+      } else if (std::holds_alternative<mgis::span<real>>(pv->second)) {
+        const auto& v = std::get<mgis::span<real>>(pv->second);
+        add_operation(v.data(), v.size());
+      } else {
+        const auto& v = std::get<std::vector<real>>(pv->second);
+        add_operation(v.data(), v.size());
+      }
+      offset += s;
+    }
+    if ((p.uniform_variables.empty()) && (p.variable_variables.size() == 1)) {
+      // the values of a single spatially variable variable can be used
+      // directly
+      p.direct_values = p.variable_variables[0].values;
+      p.direct_stride = p.variable_variables[0].stride;
+    }
+    return p;
+  }  // end of buildVariablesGatherPlan
+
+  static GatherPlan::FieldHolderLayout getFieldHolderLayout(
+      const MaterialStateManager::FieldHolder& h) {
+    if (std::holds_alternative<real>(h)) {
+      return {&h, h.index(), &(std::get<real>(h)), 1};
+    } else if (std::holds_alternative<mgis::span<real>>(h)) {
+      const auto& v = std::get<mgis::span<real>>(h);
+      return {&h, h.index(), v.data(), v.size()};
+    }
+    const auto& v = std::get<std::vector<real>>(h);
+    return {&h, h.index(), v.data(), v.size()};
+  }  // end of getFieldHolderLayout
+
+  static void appendLayoutSignature(
+      std::vector<GatherPlan::FieldHolderLayout>& signature,
+      const std::map<std::string, MaterialStateManager::FieldHolder>& values) {
+    for (const auto& v : values) {
+      signature.push_back(getFieldHolderLayout(v.second));
+    }
+  }  // end of appendLayoutSignature
+
+  /*!
+   * \brief compare the layout of the given field holders to the layout
+   * signature, starting at the given position.
+   * \return true if the layouts match.
+   * \param[in,out] pos: position in the signature
+   * \param[in] signature: signature
+   * \param[in] values: field holders
+   */
+  static bool matchLayoutSignature(
+      std::size_t& pos,
+      const std::vector<GatherPlan::FieldHolderLayout>& signature,
+      const std::map<std::string, MaterialStateManager::FieldHolder>& values) {
+    for (const auto& v : values) {
+      if (pos == signature.size()) {
+        return false;
+      }
+      if (signature[pos] != getFieldHolderLayout(v.second)) {
+        return false;
+      }
+      ++pos;
+    }
+    return true;
+  }  // end of matchLayoutSignature
+
+  static std::vector<GatherPlan::FieldHolderLayout> getLayoutSignature(
+      const MaterialDataManager& m) {
+    auto signature = std::vector<GatherPlan::FieldHolderLayout>{};
+    appendLayoutSignature(signature, m.s0.material_properties);
+    appendLayoutSignature(signature, m.s1.material_properties);
+    appendLayoutSignature(signature, m.s0.external_state_variables);
+    appendLayoutSignature(signature, m.s1.external_state_variables);
+    return signature;
+  }  // end of getLayoutSignature
+
+  GatherPlan buildGatherPlan(const MaterialDataManager& m) {
+    auto p = GatherPlan{};
+    p.mps0 = buildVariablesGatherPlan(m.s0.material_properties, m, m.b.mps);
+    p.mps1 = buildVariablesGatherPlan(m.s1.material_properties, m, m.b.mps);
+    p.esvs0 =
+        buildVariablesGatherPlan(m.s0.external_state_variables, m, m.b.esvs);
+    p.esvs1 =
+        buildVariablesGatherPlan(m.s1.external_state_variables, m, m.b.esvs);
+    p.s0_layout_version = m.s0.layout_version;
+    p.s1_layout_version = m.s1.layout_version;
+    p.layout_signature = getLayoutSignature(m);
+    return p;
+  }  // end of buildGatherPlan
+
+  bool isGatherPlanValid(const GatherPlan& p, const MaterialDataManager& m) {
+    if ((p.s0_layout_version != m.s0.layout_version) ||
+        (p.s1_layout_version != m.s1.layout_version)) {
+      return false;
+    }
+    auto pos = std::size_t{};
+    const auto& signature = p.layout_signature;
+    return (matchLayoutSignature(pos, signature, m.s0.material_properties)) &&
+           (matchLayoutSignature(pos, signature, m.s1.material_properties)) &&
+           (matchLayoutSignature(pos, signature,
+                                 m.s0.external_state_variables)) &&
+           (matchLayoutSignature(pos, signature,
+                                 m.s1.external_state_variables)) &&
+           (pos == signature.size());
+  }  // end of isGatherPlanValid
+
+}  // end of namespace mgis::behaviour
@@ -13,13 +13,24 @@
 
 #include <map>
 #include <tuple>
+#include <atomic>
+#include <chrono>
 #include <thread>
 #include <memory>
+#include <numeric>
+#include <algorithm>
+#include <cstdio>
 #include <cstdlib>
+#include <ostream>
 #include <cinttypes>
 #include "MGIS/Raise.hxx"
+#include "MGIS/Utilities/Markdown.hxx"
+#include "MGIS/Partition.hxx"
 #include "MGIS/ThreadPool.hxx"
+#include "MGIS/ParallelFor.hxx"
+#include "MGIS/Behaviour/GatherPlan.hxx"
 #include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/TangentOperatorStorage.hxx"
 #include "MGIS/Behaviour/Integrate.hxx"
 
 namespace mgis::behaviour::internals {
@@ -43,146 +54,149 @@ namespace mgis::behaviour::internals {
     return static_cast<int>(opts.integration_type);
   }  // end of encodeBehaviourIntegrationOptions
 
-  //! \brief a simple alias
-  using Evaluator = std::tuple<size_type,  // offset
-                               size_type,  // variable size
-                               const real*>;
-
-  /*
-   * \brief uniform values are treated immediatly. For spatially variable
-   * fields, we return the information needed to evaluate them
-   */
-  static inline std::vector<Evaluator> buildEvaluator(
-      std::vector<real>& v,
-      std::map<std::string, MaterialStateManager::FieldHolder>& values,
-      const MaterialDataManager& m,
-      const std::vector<Variable>& ds) {
-    mgis::raise_if(v.size() != getArraySize(ds, m.b.hypothesis),
-                   "buildEvaluator: ill allocated memory");
-    // evaluators
-    std::vector<Evaluator> evaluators;
-    auto offset = mgis::size_type{};
-    for (const auto& d : ds) {
-      const auto s = getVariableSize(d, m.b.hypothesis);
-      auto p = values.find(d.name);
-      if (p == values.end()) {
-        auto msg = std::string{"buildEvaluator: no variable named '" + d.name +
-                               "' declared"};
-        if (!values.empty()) {
-          msg += "\nThe following variables were declared: ";
-          for (const auto& variable : values) {
-            msg += "\n- " + variable.first;
-          }
-        } else {
-          msg += "\nNo variable declared.";
-        }
-        mgis::raise(msg);
-      }
-      auto set_values = [&](const auto& variable_values) {
-        if (variable_values.size() == s) {
-          // uniform value
-          std::copy(variable_values.begin(), variable_values.end(),
-                    v.begin() + offset);
-        } else {
-          evaluators.push_back(
-              std::make_tuple(offset, s, variable_values.data()));
-        }
-      };
-      if (std::holds_alternative<real>(p->second)) {
-        if (d.type != Variable::SCALAR) {
-          mgis::raise(
-              "buildEvaluator: invalid type for "
-              "variable '" +
-              d.name + "'");
-        }
-        v[offset] = std::get<real>(p->second);
-      } else if (std::holds_alternative<mgis::span<real>>(p->second)) {
-        set_values(std::get<mgis::span<real>>(p->second));
-      } else {
-        set_values(std::get<std::vector<real>>(p->second));
+  static const BehaviourPostProcessing& getBehaviourPostProcessing(
+      const Behaviour& b, const std::string_view n) {
+    const auto p = b.postprocessings.find(n);
+    if (p == b.postprocessings.end()) {
+      mgis::raise(
+          "getBehaviourPostProcessing: "
+          "no postprocessing named '" +
+          std::string{n} + "'");
+    }
+    return p->second;
+  }  // end of getBehaviourPostProcessing
+
+  //! \brief post-processing executed by the integrate functions
+  struct IntegrationPostProcessing {
+    //! \brief name of the post-processing
+    const std::string* name;
+    //! \brief post-processing
+    const BehaviourPostProcessing* p;
+    //! \brief outputs
+    real* outputs;
+    //! \brief size of the outputs per integration point
+    size_type outputs_stride;
+  };  // end of struct IntegrationPostProcessing
+
+  /*!
+   * \return the post-processings executed by the integrate functions
+   * \param[in] m: material data manager
+   * \param[in] opts: integration options
+   */
+  static std::vector<IntegrationPostProcessing> getIntegrationPostProcessings(
+      const MaterialDataManager& m, const BehaviourIntegrationOptions& opts) {
+    auto posts = std::vector<IntegrationPostProcessing>{};
+    if (static_cast<int>(opts.integration_type) < 0) {
+      return posts;
+    }
+    posts.reserve(opts.postprocessings.size());
+    for (const auto& post : opts.postprocessings) {
+      const auto& p = getBehaviourPostProcessing(m.b, post.name);
+      const auto ostride = getArraySize(p.outputs, m.b.hypothesis);
+      if (static_cast<size_type>(post.outputs.size()) != m.n * ostride) {
+        mgis::raise(
+            "integrate: "
+            "invalid size of the outputs of the post-processing '" +
+            post.name + "'");
       }
-      offset += s;
-    }
-    return evaluators;
-  }  // end of buildEvaluator
-
-  static inline void applyEvaluators(std::vector<real>& values,
-                                     const std::vector<Evaluator>& evs,
-                                     const size_type i) {
-    for (const auto& ev : evs) {
-      const auto o = std::get<0>(ev);
-      const auto s = std::get<1>(ev);
-      if (s == 1) {
-        const auto* const v = std::get<2>(ev) + i;
-        values[o] = *v;
+      posts.push_back({&post.name, &p, post.outputs.data(), ostride});
+    }
+    return posts;
+  }  // end of getIntegrationPostProcessings
+
+  /*!
+   * \brief apply the given gathering operations
+   * \param[out] values: gathered values
+   * \param[in] ops: gathering operations
+   * \param[in] i: integration point
+   */
+  static inline void applyGatheringOperations(
+      std::vector<real>& values,
+      const std::vector<GatheringOperation>& ops,
+      const size_type i) {
+    for (const auto& op : ops) {
+      const auto* const v = op.values + i * op.stride;
+      if (op.size == 1) {
+        values[op.offset] = *v;
       } else {
-        const auto* const v = std::get<2>(ev) + i * s;
-        std::copy(v, v + s, values.begin() + o);
+        std::copy(v, v + op.size, values.begin() + op.offset);
       }
     }
-  }  // end of applyEvaluators
+  }  // end of applyGatheringOperations
 
   /*!
-   * \brief small structure in charge of storing evaluators associated with a
-   * behaviour.
+   * \brief initialize the gathering of a set of variables for a range of
+   * integration points: the uniform values are copied in the given buffer.
+   * \return a pointer to the buffer if the values can't be accessed directly
+   * \param[out] values: buffer
+   * \param[in] p: gather plan
    */
-  struct BehaviourEvaluators {
-    /*!
-     * \brief evaluators associated with the material properties at the
-     * beginning of the time step
-     */
-    std::vector<Evaluator> mps0;
-    /*!
-     * \brief evaluators associated with the material properties at the
-     * end of the time step
-     */
-    std::vector<Evaluator> mps1;
-    /*!
-     * \brief evaluators associated with the external state variables at the
-     * beginning of the time step
-     */
-    std::vector<Evaluator> esvs0;
-    /*!
-     * \brief evaluators associated with the external state variables at the
-     * end of the time step
-     */
-    std::vector<Evaluator> esvs1;
-  };  // end of struct BehaviourEvaluators
-
-  static inline BehaviourEvaluators buildBehaviourEvaluators(
-      BehaviourIntegrationWorkSpace& ws, MaterialDataManager& m) {
-    //
-    auto evaluators = BehaviourEvaluators{};
-    // treating uniform values
-    evaluators.mps0 = internals::buildEvaluator(
-        ws.mps0, m.s0.material_properties, m, m.b.mps);
-    evaluators.mps1 = internals::buildEvaluator(
-        ws.mps1, m.s1.material_properties, m, m.b.mps);
-    evaluators.esvs0 = internals::buildEvaluator(
-        ws.esvs0, m.s0.external_state_variables, m, m.b.esvs);
-    evaluators.esvs1 = internals::buildEvaluator(
-        ws.esvs1, m.s1.external_state_variables, m, m.b.esvs);
-    return evaluators;
-  }  // end of buildBehaviourEvaluator
-
-  static inline void evaluate(
+  static inline const real* initializeGathering(std::vector<real>& values,
+                                                const VariablesGatherPlan& p) {
+    if (p.direct_values != nullptr) {
+      return nullptr;
+    }
+    applyGatheringOperations(values, p.uniform_variables, 0);
+    return values.data();
+  }  // end of initializeGathering
+
+  /*!
+   * \brief gather the values of a set of variables for one integration point.
+   * \param[out] ptr: pointer to the gathered values
+   * \param[out] values: buffer
+   * \param[in] p: gather plan
+   * \param[in] i: integration point
+   */
+  static inline void gather(const real*& ptr,
+                            std::vector<real>& values,
+                            const VariablesGatherPlan& p,
+                            const size_type i) {
+    if (p.direct_values != nullptr) {
+      ptr = p.direct_values + i * p.direct_stride;
+    } else {
+      applyGatheringOperations(values, p.variable_variables, i);
+    }
+  }  // end of gather
+
+  /*!
+   * \brief initialize the gathering of the material properties and external
+   * state variables for a range of integration points.
+   * \param[out] v: behaviour data view
+   * \param[out] ws: workspace
+   * \param[in] p: gather plan
+   */
+  static inline void initializeGathering(
+      mgis::behaviour::BehaviourDataView& v,
       mgis::behaviour::BehaviourIntegrationWorkSpace& ws,
-      const BehaviourEvaluators& evaluators,
-      const size_type i) {
-    applyEvaluators(ws.mps0, evaluators.mps0, i);
-    applyEvaluators(ws.mps1, evaluators.mps1, i);
-    applyEvaluators(ws.esvs0, evaluators.esvs0, i);
-    applyEvaluators(ws.esvs1, evaluators.esvs1, i);
-  }
+      const GatherPlan& p) {
+    v.s0.material_properties = initializeGathering(ws.mps0, p.mps0);
+    v.s1.material_properties = initializeGathering(ws.mps1, p.mps1);
+    v.s0.external_state_variables = initializeGathering(ws.esvs0, p.esvs0);
+    v.s1.external_state_variables = initializeGathering(ws.esvs1, p.esvs1);
+  }  // end of initializeGathering
+
+  /*!
+   * \brief gather the material properties and external state variables of
+   * an integration point.
+   * \param[out] v: behaviour data view
+   * \param[out] ws: workspace
+   * \param[in] p: gather plan
+   * \param[in] i: integration point
+   */
+  static inline void gather(mgis::behaviour::BehaviourDataView& v,
+                            mgis::behaviour::BehaviourIntegrationWorkSpace& ws,
+                            const GatherPlan& p,
+                            const size_type i) {
+    gather(v.s0.material_properties, ws.mps0, p.mps0, i);
+    gather(v.s1.material_properties, ws.mps1, p.mps1, i);
+    gather(v.s0.external_state_variables, ws.esvs0, p.esvs0, i);
+    gather(v.s1.external_state_variables, ws.esvs1, p.esvs1, i);
+  }  // end of gather
 
   static inline mgis::behaviour::BehaviourDataView initializeBehaviourDataView(
       mgis::behaviour::BehaviourIntegrationWorkSpace& ws) {
     auto v = mgis::behaviour::BehaviourDataView{};
     v.error_message = ws.error_message.data();
-    v.s0.material_properties = ws.mps0.data();
-    v.s1.material_properties = ws.mps1.data();
-    v.s0.external_state_variables = ws.esvs0.data();
-    v.s1.external_state_variables = ws.esvs1.data();
     v.s0.stored_energy = nullptr;
     v.s1.stored_energy = nullptr;
     v.s0.dissipated_energy = nullptr;
@@ -190,9 +204,49 @@ namespace mgis::behaviour::internals {
     return v;
   }  // end of initializeBehaviourDataView
 
-  static inline void updateView(mgis::behaviour::BehaviourDataView& v,
-                                const mgis::behaviour::MaterialDataManager& m,
-                                const size_type i) {
+  /*!
+   * \brief convert values stored in single precision to double precision
+   * \param[out] r: converted values
+   * \param[in] v: values
+   */
+  static inline void convertToDoublePrecision(std::vector<real>& r,
+                                              const float* const v) {
+    for (size_type i = 0; i != r.size(); ++i) {
+      r[i] = static_cast<real>(v[i]);
+    }
+  }  // end of convertToDoublePrecision
+
+  /*!
+   * \brief round values to single precision
+   * \param[out] r: rounded values
+   * \param[in] v: values
+   */
+  static inline void convertToSinglePrecision(float* const r,
+                                              const std::vector<real>& v) {
+    for (size_type i = 0; i != v.size(); ++i) {
+      r[i] = static_cast<float>(v[i]);
+    }
+  }  // end of convertToSinglePrecision
+
+  /*!
+   * \brief update the view on the data of an integration point.
+   *
+   * In the single precision storage mode, the gradients, thermodynamic
+   * forces and internal state variables of the integration point are
+   * converted in the buffers of the workspace and the view points to those
+   * buffers. The `storeState` function must then be called to update the
+   * state at the end of the time step.
+   *
+   * \param[out] v: behaviour data view
+   * \param[out] ws: workspace
+   * \param[in] m: material data manager
+   * \param[in] i: integration point
+   */
+  static inline void updateView(
+      mgis::behaviour::BehaviourDataView& v,
+      mgis::behaviour::BehaviourIntegrationWorkSpace& ws,
+      const mgis::behaviour::MaterialDataManager& m,
+      const size_type i) {
     // strides
     const auto g_stride = m.s0.gradients_stride;
     const auto t_stride = m.s0.thermodynamic_forces_stride;
@@ -200,14 +254,43 @@ namespace mgis::behaviour::internals {
     const auto computes_stored_energy = m.b.computesStoredEnergy;
     const auto computes_dissipated_energy = m.b.computesDissipatedEnergy;
     v.speed_of_sound = m.speed_of_sound.data() + i;
-    v.s0.gradients = m.s0.gradients.data() + g_stride * i;
-    v.s1.gradients = m.s1.gradients.data() + g_stride * i;
-    v.s0.thermodynamic_forces = m.s0.thermodynamic_forces.data() + t_stride * i;
-    v.s1.thermodynamic_forces = m.s1.thermodynamic_forces.data() + t_stride * i;
-    v.s0.internal_state_variables =
-        m.s0.internal_state_variables.data() + isvs_stride * i;
-    v.s1.internal_state_variables =
-        m.s1.internal_state_variables.data() + isvs_stride * i;
+    if (m.s0.precision == StateStoragePrecision::SINGLE_PRECISION) {
+      convertToDoublePrecision(
+          ws.gradients0, m.s0.single_precision_gradients.data() + g_stride * i);
+      convertToDoublePrecision(
+          ws.gradients1, m.s1.single_precision_gradients.data() + g_stride * i);
+      convertToDoublePrecision(
+          ws.thermodynamic_forces0,
+          m.s0.single_precision_thermodynamic_forces.data() + t_stride * i);
+      convertToDoublePrecision(
+          ws.thermodynamic_forces1,
+          m.s1.single_precision_thermodynamic_forces.data() + t_stride * i);
+      convertToDoublePrecision(
+          ws.internal_state_variables0,
+          m.s0.single_precision_internal_state_variables.data() +
+              isvs_stride * i);
+      convertToDoublePrecision(
+          ws.internal_state_variables1,
+          m.s1.single_precision_internal_state_variables.data() +
+              isvs_stride * i);
+      v.s0.gradients = ws.gradients0.data();
+      v.s1.gradients = ws.gradients1.data();
+      v.s0.thermodynamic_forces = ws.thermodynamic_forces0.data();
+      v.s1.thermodynamic_forces = ws.thermodynamic_forces1.data();
+      v.s0.internal_state_variables = ws.internal_state_variables0.data();
+      v.s1.internal_state_variables = ws.internal_state_variables1.data();
+    } else {
+      v.s0.gradients = m.s0.gradients.data() + g_stride * i;
+      v.s1.gradients = m.s1.gradients.data() + g_stride * i;
+      v.s0.thermodynamic_forces =
+          m.s0.thermodynamic_forces.data() + t_stride * i;
+      v.s1.thermodynamic_forces =
+          m.s1.thermodynamic_forces.data() + t_stride * i;
+      v.s0.internal_state_variables =
+          m.s0.internal_state_variables.data() + isvs_stride * i;
+      v.s1.internal_state_variables =
+          m.s1.internal_state_variables.data() + isvs_stride * i;
+    }
     if (computes_stored_energy) {
       v.s0.stored_energy = m.s0.stored_energies.data() + i;
       v.s1.stored_energy = m.s1.stored_energies.data() + i;
@@ -218,6 +301,33 @@ namespace mgis::behaviour::internals {
     }
   }  // end of updateView
 
+  /*!
+   * \brief in the single precision storage mode, round the thermodynamic
+   * forces and the internal state variables computed in the buffers of the
+   * workspace and store them in the state at the end of the time step. This
+   * function does nothing in the double precision storage mode.
+   * \param[out] m: material data manager
+   * \param[in] ws: workspace
+   * \param[in] i: integration point
+   */
+  static inline void storeState(
+      mgis::behaviour::MaterialDataManager& m,
+      const mgis::behaviour::BehaviourIntegrationWorkSpace& ws,
+      const size_type i) {
+    if (m.s1.precision != StateStoragePrecision::SINGLE_PRECISION) {
+      return;
+    }
+    const auto t_stride = m.s1.thermodynamic_forces_stride;
+    const auto isvs_stride = m.s1.internal_state_variables_stride;
+    convertToSinglePrecision(
+        m.s1.single_precision_thermodynamic_forces.data() + t_stride * i,
+        ws.thermodynamic_forces1);
+    convertToSinglePrecision(
+        m.s1.single_precision_internal_state_variables.data() +
+            isvs_stride * i,
+        ws.internal_state_variables1);
+  }  // end of storeState
+
   static inline void checkIntegrationPointsRange(
       const mgis::behaviour::MaterialDataManager& m,
       const size_type b,
@@ -235,31 +345,132 @@ namespace mgis::behaviour::internals {
     }
   }  // end of checkIntegrationPointsRange
 
+  /*!
+   * \brief check that the given indices are valid integration points
+   * indices. The indices may be unsorted, but duplicates are rejected since
+   * an integration point would be treated twice, possibly concurrently by
+   * the multi-threaded functions.
+   *
+   * The cost of this check only depends on the number of selected
+   * integration points: sorted indices (see the overloads based on a mask)
+   * are checked in place, otherwise a sorted copy is checked.
+   *
+   * \param[in] m: material data manager
+   * \param[in] indices: indices of the integration points
+   */
+  static inline void checkIntegrationPointsIndices(
+      const mgis::behaviour::MaterialDataManager& m,
+      mgis::span<const size_type> indices) {
+    if (indices.empty()) {
+      return;
+    }
+    auto check = [&m](const size_type* const b, const size_type* const e) {
+      const auto last = *(e - 1);
+      if (last >= m.n) {
+        mgis::raise(
+            "checkIntegrationPointsIndices: "
+            "invalid integration point index ('" +
+            std::to_string(last) + "')");
+      }
+      const auto p = std::adjacent_find(b, e);
+      if (p != e) {
+        mgis::raise(
+            "checkIntegrationPointsIndices: "
+            "integration point '" +
+            std::to_string(*p) + "' is selected more than once");
+      }
+    };
+    const auto* const b = indices.data();
+    const auto* const e = b + indices.size();
+    if (std::is_sorted(b, e)) {
+      check(b, e);
+      return;
+    }
+    auto sorted = std::vector<size_type>(b, e);
+    std::sort(sorted.begin(), sorted.end());
+    check(sorted.data(), sorted.data() + sorted.size());
+  }  // end of checkIntegrationPointsIndices
+
+  /*!
+   * \return the indices of the integration points selected by a mask
+   * \param[in] m: material data manager
+   * \param[in] mask: mask
+   */
+  static std::vector<size_type> getIntegrationPointsIndices(
+      const mgis::behaviour::MaterialDataManager& m,
+      const std::vector<bool>& mask) {
+    if (mask.size() != m.n) {
+      mgis::raise(
+          "getIntegrationPointsIndices: "
+          "the size of the mask does not match the number of integration "
+          "points");
+    }
+    auto indices = std::vector<size_type>{};
+    for (size_type i = 0; i != m.n; ++i) {
+      if (mask[i]) {
+        indices.push_back(i);
+      }
+    }
+    return indices;
+  }  // end of getIntegrationPointsIndices
+
+  /*!
+   * \brief mapping used by the functions treating a range `[b, e)` of
+   * integration points: the `k`th treated integration point is `k`.
+   */
+  struct ContiguousIntegrationPoints {
+    constexpr size_type operator()(const size_type k) const noexcept {
+      return k;
+    }
+  };  // end of struct ContiguousIntegrationPoints
+
+  /*!
+   * \brief mapping used by the functions treating a list of integration
+   * points: the `k`th treated integration point is `indices[k]`.
+   */
+  struct IndexedIntegrationPoints {
+    size_type operator()(const size_type k) const noexcept {
+      return indices[k];
+    }
+    //! \brief indices of the integration points
+    mgis::span<const size_type> indices;
+  };  // end of struct IndexedIntegrationPoints
+
   /*!
    * \brief execute the given initialize function over a range of integration
    * points.
+   *
+   * \note the treated integration points are given by `ips(k)` for `k` in
+   * `[b, e)`.
    */
+  template <typename IntegrationPoints = ContiguousIntegrationPoints>
   static BehaviourIntegrationResult executeInitializeFunction(
+      BehaviourIntegrationWorkSpace& ws,
+      const GatherPlan& gp,
       MaterialDataManager& m,
-      const BehaviourInitializeFunction p,
+      const BehaviourInitializeFunction& p,
       const mgis::size_type b,
-      const mgis::size_type e) {
-    // workspace
-    auto& ws = m.getBehaviourIntegrationWorkSpace();
+      const mgis::size_type e,
+      const IntegrationPoints& ips = {}) {
     auto v = internals::initializeBehaviourDataView(ws);
-    auto behaviour_evaluators = internals::buildBehaviourEvaluators(ws, m);
+    internals::initializeGathering(v, ws, gp);
     v.rdt = nullptr;
     // loop over integration points
     auto r = BehaviourIntegrationResult{};
-    for (auto i = b; i != e; ++i) {
-      internals::evaluate(ws, behaviour_evaluators, i);
-      internals::updateView(v, m, i);
+    for (auto k = b; k != e; ++k) {
+      const auto i = ips(k);
+      internals::gather(v, ws, gp, i);
+      internals::updateView(v, ws, m, i);
       v.dt = mgis::real{};
       const auto ri = (p.f)(&v, nullptr);
-      if (ri != 0) {
+      if (ri == 0) {
+        internals::storeState(m, ws, i);
+      } else {
+        r.exit_status = -1;
         r.n = i;
         v.error_message[511] = '\0';
         r.error_message = std::string(v.error_message);
+        r.failures.push_back({i, ri, r.error_message});
         return r;
       }
     }
@@ -269,120 +480,760 @@ namespace mgis::behaviour::internals {
   /*!
    * \brief execute the given initialize function over a range of integration
    * points.
+   *
+   * \note the treated integration points are given by `ips(k)` for `k` in
+   * `[b, e)`.
    */
+  template <typename IntegrationPoints = ContiguousIntegrationPoints>
   static BehaviourIntegrationResult executeInitializeFunction(
+      BehaviourIntegrationWorkSpace& ws,
+      const GatherPlan& gp,
       MaterialDataManager& m,
-      const BehaviourInitializeFunction p,
+      const BehaviourInitializeFunction& p,
       mgis::span<const real> inputs,
       const mgis::size_type inputs_stride,
       const mgis::size_type b,
-      const mgis::size_type e) {
-    // workspace
-    auto& ws = m.getBehaviourIntegrationWorkSpace();
+      const mgis::size_type e,
+      const IntegrationPoints& ips = {}) {
     auto v = internals::initializeBehaviourDataView(ws);
-    auto behaviour_evaluators = internals::buildBehaviourEvaluators(ws, m);
+    internals::initializeGathering(v, ws, gp);
     v.rdt = nullptr;
     // loop over integration points
     auto r = BehaviourIntegrationResult{};
     const auto* const inputs_values = inputs.data();
-    for (auto i = b; i != e; ++i) {
-      internals::evaluate(ws, behaviour_evaluators, i);
-      internals::updateView(v, m, i);
+    for (auto k = b; k != e; ++k) {
+      const auto i = ips(k);
+      internals::gather(v, ws, gp, i);
+      internals::updateView(v, ws, m, i);
       v.dt = mgis::real{};
       const auto ri = (p.f)(&v, inputs_values + inputs_stride * i);
-      if (ri != 0) {
+      if (ri == 0) {
+        internals::storeState(m, ws, i);
+      } else {
+        r.exit_status = -1;
         r.n = i;
         v.error_message[511] = '\0';
         r.error_message = std::string(v.error_message);
+        r.failures.push_back({i, ri, r.error_message});
         return r;
       }
     }
     return r;
   }  // end of executeInitializeFunction
 
+  //! \brief temporary memory used by the local sub-stepping
+  struct LocalSubSteppingWorkSpace {
+    /*!
+     * \brief constructor
+     * \param[in] m: material data manager
+     */
+    LocalSubSteppingWorkSpace(const MaterialDataManager& m)
+        : gradients0(m.s0.gradients_stride),
+          gradients1(m.s0.gradients_stride),
+          thermodynamic_forces0(m.s0.thermodynamic_forces_stride),
+          thermodynamic_forces1(m.s0.thermodynamic_forces_stride),
+          internal_state_variables0(m.s0.internal_state_variables_stride),
+          internal_state_variables1(m.s0.internal_state_variables_stride),
+          mps0(getArraySize(m.b.mps, m.b.mps_index, m.b.hypothesis)),
+          mps1(getArraySize(m.b.mps, m.b.mps_index, m.b.hypothesis)),
+          esvs0(getArraySize(m.b.esvs, m.b.esvs_index, m.b.hypothesis)),
+          esvs1(getArraySize(m.b.esvs, m.b.esvs_index, m.b.hypothesis)),
+          K(std::max(getTangentOperatorArraySize(m.b),
+                     size_type{Behaviour::nopts + 1})) {}
+    //! \brief gradients at the beginning of the sub-step
+    std::vector<real> gradients0;
+    //! \brief gradients at the end of the sub-step
+    std::vector<real> gradients1;
+    //! \brief thermodynamic forces at the beginning of the sub-step
+    std::vector<real> thermodynamic_forces0;
+    //! \brief thermodynamic forces at the end of the sub-step
+    std::vector<real> thermodynamic_forces1;
+    //! \brief internal state variables at the beginning of the sub-step
+    std::vector<real> internal_state_variables0;
+    //! \brief internal state variables at the end of the sub-step
+    std::vector<real> internal_state_variables1;
+    //! \brief material properties at the beginning of the sub-step
+    std::vector<real> mps0;
+    //! \brief material properties at the end of the sub-step
+    std::vector<real> mps1;
+    //! \brief external state variables at the beginning of the sub-step
+    std::vector<real> esvs0;
+    //! \brief external state variables at the end of the sub-step
+    std::vector<real> esvs1;
+    //! \brief stiffness matrix
+    std::vector<real> K;
+    //! \brief stored energies at the beginning and at the end of the sub-step
+    real stored_energies[2];
+    /*!
+     * \brief dissipated energies at the beginning and at the end of the
+     * sub-step
+     */
+    real dissipated_energies[2];
+    //! \brief speed of sound
+    real speed_of_sound;
+  };  // end of struct LocalSubSteppingWorkSpace
+
+  /*!
+   * \brief linear interpolation between two arrays
+   * \param[out] r: result
+   * \param[in] v0: values at the beginning of the time step
+   * \param[in] v1: values at the end of the time step
+   * \param[in] a: interpolation factor
+   */
+  static inline void interpolate(std::vector<real>& r,
+                                 const real* const v0,
+                                 const real* const v1,
+                                 const real a) {
+    for (size_type i = 0; i != r.size(); ++i) {
+      r[i] = v0[i] + a * (v1[i] - v0[i]);
+    }
+  }  // end of interpolate
+
+  /*!
+   * \brief integrate the behaviour at one integration point by splitting the
+   * time step in local sub-steps. The gradients, material properties and
+   * external state variables are linearly interpolated between the beginning
+   * and the end of the time step.
+   *
+   * \return the exit status of the integration
+   * \param[out] nsubsteps: number of sub-steps performed. This number is
+   * null if the integration failed.
+   * \param[in,out] rdt: time step increase factor. On input, this factor is
+   * the one proposed by the behaviour when integrated over the whole time
+   * step. On output, this factor is the one proposed for the last sub-step.
+   * \param[in,out] ws: workspace
+   * \param[in] v: view on the data of the integration point over the whole
+   * time step
+   * \param[in] m: material data manager
+   * \param[in] Ke: integration options, encoded as expected by the behaviour
+   * \param[in] rdt0: initial value of the time step increase factor passed
+   * to the behaviour
+   * \param[in] mnsubsteps: maximum number of sub-steps
+   * \param[in] Ksize: number of components of the stiffness matrix to be
+   * copied in `v.K` in case of success
+   *
+   * \note the outputs of the integration (thermodynamic forces, internal
+   * state variables, energies, stiffness matrix, speed of sound) are only
+   * updated if the integration succeeds.
+   * \note the stiffness matrix is the one computed during the last sub-step.
+   */
+  static int integrateWithLocalSubStepping(size_type& nsubsteps,
+                                           real& rdt,
+                                           LocalSubSteppingWorkSpace& ws,
+                                           const BehaviourDataView& v,
+                                           const MaterialDataManager& m,
+                                           const real Ke,
+                                           const real rdt0,
+                                           const size_type mnsubsteps,
+                                           const size_type Ksize) {
+    // factor used to reduce the size of the sub-steps after a failure
+    auto reduction_factor = [](const real f) {
+      if ((f > 0) && (f < 1)) {
+        return std::max(f, real(0.1));
+      }
+      return real(0.5);
+    };
+    const auto ts = m.s0.thermodynamic_forces_stride;
+    const auto isvs = m.s0.internal_state_variables_stride;
+    std::copy(v.s0.thermodynamic_forces, v.s0.thermodynamic_forces + ts,
+              ws.thermodynamic_forces0.begin());
+    std::copy(v.s0.internal_state_variables,
+              v.s0.internal_state_variables + isvs,
+              ws.internal_state_variables0.begin());
+    auto sv = v;
+    sv.s0.gradients = ws.gradients0.data();
+    sv.s1.gradients = ws.gradients1.data();
+    sv.s0.thermodynamic_forces = ws.thermodynamic_forces0.data();
+    sv.s1.thermodynamic_forces = ws.thermodynamic_forces1.data();
+    sv.s0.internal_state_variables = ws.internal_state_variables0.data();
+    sv.s1.internal_state_variables = ws.internal_state_variables1.data();
+    sv.s0.material_properties = ws.mps0.data();
+    sv.s1.material_properties = ws.mps1.data();
+    sv.s0.external_state_variables = ws.esvs0.data();
+    sv.s1.external_state_variables = ws.esvs1.data();
+    if (v.s0.stored_energy != nullptr) {
+      ws.stored_energies[0] = *(v.s0.stored_energy);
+      sv.s0.stored_energy = &(ws.stored_energies[0]);
+      sv.s1.stored_energy = &(ws.stored_energies[1]);
+    }
+    if (v.s0.dissipated_energy != nullptr) {
+      ws.dissipated_energies[0] = *(v.s0.dissipated_energy);
+      sv.s0.dissipated_energy = &(ws.dissipated_energies[0]);
+      sv.s1.dissipated_energy = &(ws.dissipated_energies[1]);
+    }
+    sv.K = ws.K.data();
+    if (!m.speed_of_sound.empty()) {
+      sv.speed_of_sound = &(ws.speed_of_sound);
+    }
+    auto ri = 1;
+    // beginning of the current sub-step, expressed as a fraction of the time
+    // step
+    auto a = real(0);
+    // size of the current sub-step, expressed as a fraction of the time step
+    auto da = reduction_factor(rdt);
+    nsubsteps = 0;
+    for (size_type attempt = 0; attempt != mnsubsteps; ++attempt) {
+      const auto last = a + da > 1 - 1e-12;
+      const auto b = last ? real(1) : a + da;
+      interpolate(ws.gradients0, v.s0.gradients, v.s1.gradients, a);
+      interpolate(ws.gradients1, v.s0.gradients, v.s1.gradients, b);
+      interpolate(ws.mps0, v.s0.material_properties, v.s1.material_properties,
+                  a);
+      interpolate(ws.mps1, v.s0.material_properties, v.s1.material_properties,
+                  b);
+      interpolate(ws.esvs0, v.s0.external_state_variables,
+                  v.s1.external_state_variables, a);
+      interpolate(ws.esvs1, v.s0.external_state_variables,
+                  v.s1.external_state_variables, b);
+      std::copy(ws.thermodynamic_forces0.begin(),
+                ws.thermodynamic_forces0.end(),
+                ws.thermodynamic_forces1.begin());
+      std::copy(ws.internal_state_variables0.begin(),
+                ws.internal_state_variables0.end(),
+                ws.internal_state_variables1.begin());
+      auto srdt = rdt0;
+      sv.rdt = &srdt;
+      sv.dt = v.dt * (b - a);
+      sv.K[0] = Ke;
+      v.error_message[0] = '\0';
+      const auto sri = integrate(sv, m.b);
+      if (sri == -1) {
+        da *= reduction_factor(srdt);
+        continue;
+      }
+      // the sub-step succeeded
+      ri = std::min(ri, sri);
+      ++nsubsteps;
+      a = b;
+      if (last) {
+        // copy the results
+        std::copy(ws.thermodynamic_forces1.begin(),
+                  ws.thermodynamic_forces1.end(), v.s1.thermodynamic_forces);
+        std::copy(ws.internal_state_variables1.begin(),
+                  ws.internal_state_variables1.end(),
+                  v.s1.internal_state_variables);
+        if (v.s1.stored_energy != nullptr) {
+          *(v.s1.stored_energy) = ws.stored_energies[1];
+        }
+        if (v.s1.dissipated_energy != nullptr) {
+          *(v.s1.dissipated_energy) = ws.dissipated_energies[1];
+        }
+        if (!m.speed_of_sound.empty()) {
+          *(v.speed_of_sound) = ws.speed_of_sound;
+        }
+        std::copy(ws.K.begin(), ws.K.begin() + Ksize, v.K);
+        // the time step shall not be increased
+        rdt = std::min(srdt, real(1));
+        return ri;
+      }
+      ws.thermodynamic_forces0.swap(ws.thermodynamic_forces1);
+      ws.internal_state_variables0.swap(ws.internal_state_variables1);
+      sv.s0.thermodynamic_forces = ws.thermodynamic_forces0.data();
+      sv.s1.thermodynamic_forces = ws.thermodynamic_forces1.data();
+      sv.s0.internal_state_variables = ws.internal_state_variables0.data();
+      sv.s1.internal_state_variables = ws.internal_state_variables1.data();
+      ws.stored_energies[0] = ws.stored_energies[1];
+      ws.dissipated_energies[0] = ws.dissipated_energies[1];
+      // the size of the sub-steps is only reduced after a failure
+      da = std::min(da * std::min(std::max(srdt, real(1)), real(2)), 1 - a);
+    }
+    if (v.error_message[0] == '\0') {
+      std::snprintf(v.error_message, 512,
+                    "local sub-stepping failed: maximum number of sub-steps "
+                    "reached");
+    }
+    nsubsteps = 0;
+    return -1;
+  }  // end of integrateWithLocalSubStepping
+
+  /*!
+   * \brief update a profile after the integration of one integration point
+   * \param[in,out] p: profile
+   * \param[in] ri: exit status of the behaviour
+   * \param[in] rdt: proposed time step increase factor
+   * \param[in] tb: time spent in the behaviour
+   * \param[in] td: time spent in accessing the data
+   */
+  static void updateBehaviourIntegrationProfile(BehaviourIntegrationProfile& p,
+                                                const int ri,
+                                                const real rdt,
+                                                const real tb,
+                                                const real td) {
+    const auto& bounds = BehaviourIntegrationProfile::rdt_histogram_bounds;
+    ++(p.number_of_integration_points);
+    if (ri == 0) {
+      ++(p.number_of_unreliable_results);
+    } else if (ri == -1) {
+      ++(p.number_of_failures);
+    }
+    p.behaviour_time += tb;
+    p.data_access_time += td;
+    const auto pb = std::upper_bound(bounds.begin(), bounds.end(), rdt);
+    ++(p.rdt_histogram[pb - bounds.begin()]);
+  }  // end of updateBehaviourIntegrationProfile
+
+  /*!
+   * \brief merge two profiles
+   * \param[in,out] p: global profile
+   * \param[in] pi: profile to be merged
+   */
+  static void mergeBehaviourIntegrationProfiles(
+      BehaviourIntegrationProfile& p, const BehaviourIntegrationProfile& pi) {
+    p.number_of_integration_points += pi.number_of_integration_points;
+    p.number_of_unreliable_results += pi.number_of_unreliable_results;
+    p.number_of_failures += pi.number_of_failures;
+    p.wall_time += pi.wall_time;
+    p.data_access_time += pi.data_access_time;
+    p.behaviour_time += pi.behaviour_time;
+    for (size_type i = 0; i != p.rdt_histogram.size(); ++i) {
+      p.rdt_histogram[i] += pi.rdt_histogram[i];
+    }
+  }  // end of mergeBehaviourIntegrationProfiles
+
   /*!
    * \brief perform the integration of the behaviour over a range of integration
    * points.
+   *
+   * \note the treated integration points are given by `ips(k)` for `k` in
+   * `[b, e)`.
    */
+  template <typename IntegrationPoints = ContiguousIntegrationPoints>
   static BehaviourIntegrationResult integrate(
+      BehaviourIntegrationWorkSpace& ws,
+      const GatherPlan& gp,
       MaterialDataManager& m,
       const BehaviourIntegrationOptions& opts,
       const real dt,
       const size_type b,
-      const size_type e) {
-    // workspace
-    auto& ws = m.getBehaviourIntegrationWorkSpace();
+      const size_type e,
+      const IntegrationPoints& ips = {}) {
     auto v = internals::initializeBehaviourDataView(ws);
-    auto behaviour_evaluators = internals::buildBehaviourEvaluators(ws, m);
+    internals::initializeGathering(v, ws, gp);
     // loop over integration points
     auto r = BehaviourIntegrationResult{};
     auto rdt0 = r.time_step_increase_factor;
     const real Ke = encodeBehaviourIntegrationOptions(opts);
     real bopts[Behaviour::nopts + 1];  // option passed to the behaviour
-    for (auto i = b; i != e; ++i) {
-      internals::evaluate(ws, behaviour_evaluators, i);
-      internals::updateView(v, m, i);
+    const auto record_costs = !m.integration_costs.empty();
+    const auto profile = opts.profile;
+    const auto timed = record_costs || profile;
+    const auto use_local_substepping =
+        (opts.maximum_number_of_substeps > 1) &&
+        (static_cast<int>(opts.integration_type) >= 0);
+    auto lws = std::unique_ptr<LocalSubSteppingWorkSpace>{};
+    // the tangent operator blocks are computed in a temporary buffer and
+    // packed afterwards
+    const auto packed_K = (m.tangent_operator_storage ==
+                           TangentOperatorStorage::PACKED_SYMMETRIC_BLOCKS) &&
+                          (opts.integration_type !=
+                           IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR) &&
+                          (m.K_stride != 0);
+    const auto Ksize = getTangentOperatorArraySize(m.b);
+    const auto posts = getIntegrationPostProcessings(m, opts);
+    // with the lazy reset policy, the stiffness matrices are not filled with
+    // zeros by the update and revert functions
+    const auto lazy_K_reset =
+        (m.getTangentOperatorResetPolicy() ==
+         MaterialDataManager::TangentOperatorResetPolicy::LAZY_RESET) &&
+        (!m.K.empty());
+    if (packed_K) {
+      ws.K.resize(std::max(Ksize, size_type{Behaviour::nopts + 1}));
+    }
+    const auto rstart = profile ? std::chrono::steady_clock::now()
+                                : std::chrono::steady_clock::time_point{};
+    for (auto k = b; k != e; ++k) {
+      const auto i = ips(k);
+      const auto pstart = profile ? std::chrono::steady_clock::now()
+                                  : std::chrono::steady_clock::time_point{};
+      internals::gather(v, ws, gp, i);
+      internals::updateView(v, ws, m, i);
       auto rdt = rdt0;
       v.error_message[0] = '\0';
       v.rdt = &rdt;
       v.dt = dt;
-      if ((opts.integration_type !=
-           IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR) &&
-          (m.K_stride != 0)) {
+      if (packed_K) {
+        v.K = ws.K.data();
+        if (!lazy_K_reset) {
+          // the stiffness matrices are filled with zeros on entry, as with
+          // full blocks after the `update` and `revert` functions
+          std::fill(ws.K.begin() + 1, ws.K.begin() + Ksize, real(0));
+        }
+      } else if ((opts.integration_type !=
+                  IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR) &&
+                 (m.K_stride != 0)) {
         v.K = m.K.data() + m.K_stride * i;
       } else {
         v.K = &bopts[0];
       }
       v.K[0] = Ke;
-      const auto ri = integrate(v, m.b);
-      r.exit_status = std::min(ri, r.exit_status);
+      const auto start = timed ? std::chrono::steady_clock::now()
+                               : std::chrono::steady_clock::time_point{};
+      auto ri = integrate(v, m.b);
+      if ((use_local_substepping) && ((ri == -1) || (rdt < 1))) {
+        if (!lws) {
+          lws = std::make_unique<LocalSubSteppingWorkSpace>(m);
+        }
+        auto nsubsteps = size_type{};
+        auto srdt = rdt;
+        const auto sri = integrateWithLocalSubStepping(
+            nsubsteps, srdt, *lws, v, m, Ke, rdt0,
+            opts.maximum_number_of_substeps,
+            (v.K == &bopts[0]) ? size_type{0} : Ksize);
+        if ((sri != -1) || (ri == -1)) {
+          ri = sri;
+          rdt = srdt;
+        }
+        r.number_of_substeps.push_back({i, nsubsteps});
+      }
+      if ((ri != -1) && (!posts.empty())) {
+        // the post-processings are executed before storing the state, which
+        // is not stored if one of them fails
+        v.dt = real{};
+        v.rdt = nullptr;
+        for (const auto& post : posts) {
+          const auto rp =
+              (post.p->f)(post.outputs + post.outputs_stride * i, &v);
+          if (rp != 0) {
+            if (v.error_message[0] == '\0') {
+              std::snprintf(v.error_message, 512,
+                            "post-processing '%s' failed",
+                            post.name->c_str());
+            }
+            ri = -1;
+            break;
+          }
+        }
+      }
+      if (ri != -1) {
+        internals::storeState(m, ws, i);
+        if (packed_K) {
+          packTangentOperatorBlocks(m.K.data() + m.K_stride * i, v.K, m.b);
+        }
+      }
+      if (timed) {
+        const auto end = std::chrono::steady_clock::now();
+        const auto cost = std::chrono::duration<real>(end - start).count();
+        if (record_costs) {
+          m.integration_costs[i] = cost;
+        }
+        if (profile) {
+          updateBehaviourIntegrationProfile(
+              r.profile, ri, rdt, cost,
+              std::chrono::duration<real>(start - pstart).count());
+        }
+      }
       r.time_step_increase_factor = std::min(rdt, r.time_step_increase_factor);
-      if (ri == 0) {
-        r.n = i;
-      } else if (ri == -1) {
-        r.n = i;
+      if (ri == -1) {
+        if (lazy_K_reset) {
+          // don't leave the stiffness matrix of the previous time step
+          std::fill(m.K.data() + m.K_stride * i,
+                    m.K.data() + m.K_stride * (i + 1), real{0});
+        }
         v.error_message[511] = '\0';
-        r.error_message = std::string(v.error_message);
-        return r;
+        r.failures.push_back({i, ri, std::string(v.error_message)});
+        if (r.exit_status != -1) {
+          // first failure
+          r.n = i;
+          r.error_message = r.failures.back().error_message;
+        }
+        r.exit_status = -1;
+        if (opts.stop_on_failure) {
+          break;
+        }
+      } else if ((ri == 0) && (r.exit_status != -1)) {
+        r.exit_status = 0;
+        r.n = i;
       }
     }
+    if (profile) {
+      const auto rend = std::chrono::steady_clock::now();
+      r.profile.wall_time = std::chrono::duration<real>(rend - rstart).count();
+    }
     return r;
   }  // end of integrate
 
   /*!
    * \brief execute the given post-processing over a range of integration
    * points.
+   *
+   * \note the treated integration points are given by `ips(k)` for `k` in
+   * `[b, e)`.
    */
+  template <typename IntegrationPoints = ContiguousIntegrationPoints>
   static BehaviourIntegrationResult executePostProcessing(
+      BehaviourIntegrationWorkSpace& ws,
+      const GatherPlan& gp,
       mgis::span<real> outputs,
       MaterialDataManager& m,
-      const BehaviourPostProcessing p,
+      const BehaviourPostProcessing& p,
       const mgis::size_type outputs_stride,
       const mgis::size_type b,
-      const mgis::size_type e) {
-    // workspace
-    auto& ws = m.getBehaviourIntegrationWorkSpace();
+      const mgis::size_type e,
+      const IntegrationPoints& ips = {}) {
     auto v = internals::initializeBehaviourDataView(ws);
-    auto behaviour_evaluators = internals::buildBehaviourEvaluators(ws, m);
+    internals::initializeGathering(v, ws, gp);
     v.rdt = nullptr;
     // loop over integration points
     auto r = BehaviourIntegrationResult{};
     auto* const outputs_values = outputs.data();
-    for (auto i = b; i != e; ++i) {
-      internals::evaluate(ws, behaviour_evaluators, i);
-      internals::updateView(v, m, i);
+    for (auto k = b; k != e; ++k) {
+      const auto i = ips(k);
+      internals::gather(v, ws, gp, i);
+      internals::updateView(v, ws, m, i);
       v.dt = mgis::real{};
       const auto ri = (p.f)(outputs_values + outputs_stride * i, &v);
       if (ri != 0) {
+        r.exit_status = -1;
         r.n = i;
         v.error_message[511] = '\0';
         r.error_message = std::string(v.error_message);
+        r.failures.push_back({i, ri, r.error_message});
         return r;
       }
     }
     return r;
   }  // end of executePostProcessing
 
+  /*!
+   * \brief merge the result of the treatment of a set of integration points
+   * into a global result.
+   * \param[in,out] r: global result
+   * \param[in] ri: result to be merged
+   */
+  static void mergeBehaviourIntegrationResults(
+      BehaviourIntegrationResult& r, const BehaviourIntegrationResult& ri) {
+    if (ri.exit_status < r.exit_status) {
+      r.exit_status = ri.exit_status;
+      r.n = ri.n;
+      r.error_message = ri.error_message;
+    } else if ((ri.exit_status == 0) && (r.exit_status == 0)) {
+      r.n = std::max(r.n, ri.n);
+    }
+    r.time_step_increase_factor =
+        std::min(r.time_step_increase_factor, ri.time_step_increase_factor);
+    r.number_of_substeps.insert(r.number_of_substeps.end(),
+                                ri.number_of_substeps.begin(),
+                                ri.number_of_substeps.end());
+    r.failures.insert(r.failures.end(), ri.failures.begin(),
+                      ri.failures.end());
+    mergeBehaviourIntegrationProfiles(r.profile, ri.profile);
+  }  // end of mergeBehaviourIntegrationResults
+
+  /*!
+   * \brief sort a list of failures by integration point
+   * \param[in,out] failures: list of failures
+   */
+  static void sortBehaviourIntegrationFailures(
+      std::vector<BehaviourIntegrationFailure>& failures) {
+    std::stable_sort(failures.begin(), failures.end(),
+                     [](const BehaviourIntegrationFailure& f1,
+                        const BehaviourIntegrationFailure& f2) {
+                       return f1.n < f2.n;
+                     });
+  }  // end of sortBehaviourIntegrationFailures
+
+  /*!
+   * \brief sort the lists of integration points reported by a result, which
+   * may be unsorted if the integration points were not treated in order.
+   * \param[in,out] r: result
+   */
+  static void sortBehaviourIntegrationResult(BehaviourIntegrationResult& r) {
+    std::sort(r.number_of_substeps.begin(), r.number_of_substeps.end());
+    sortBehaviourIntegrationFailures(r.failures);
+    if ((r.exit_status == -1) && (!r.failures.empty())) {
+      // report the first failure
+      r.n = r.failures.front().n;
+      r.error_message = r.failures.front().error_message;
+    }
+  }  // end of sortBehaviourIntegrationResult
+
+  //! \brief a simple alias
+  using ThreadedBehaviourIntegrationTask =
+      std::future<ThreadedTaskResult<BehaviourIntegrationResult>>;
+
+  /*!
+   * \brief wait for all the given tasks and gather their results.
+   * \param[in] tasks: tasks
+   * \param[in] times: time spent by each task
+   *
+   * \note all tasks are waited for before retrieving their results, so that
+   * no task is still running if an exception is rethrown.
+   */
+  static MultiThreadedBehaviourIntegrationResult gatherResults(
+      std::vector<ThreadedBehaviourIntegrationTask>& tasks,
+      const std::vector<real>& times) {
+    for (auto& t : tasks) {
+      t.wait();
+    }
+    auto res = MultiThreadedBehaviourIntegrationResult{};
+    for (auto& t : tasks) {
+      auto ri = t.get();
+      res.exit_status = std::min(res.exit_status, ri->exit_status);
+      res.failures.insert(res.failures.end(), ri->failures.begin(),
+                          ri->failures.end());
+      res.number_of_substeps.insert(res.number_of_substeps.end(),
+                                    ri->number_of_substeps.begin(),
+                                    ri->number_of_substeps.end());
+      mergeBehaviourIntegrationProfiles(res.profile, ri->profile);
+      res.results.push_back(*ri);
+    }
+    std::sort(res.number_of_substeps.begin(), res.number_of_substeps.end());
+    sortBehaviourIntegrationFailures(res.failures);
+    const auto tmax = *(std::max_element(times.begin(), times.end()));
+    const auto tmean =
+        std::accumulate(times.begin(), times.end(), real{0}) / times.size();
+    if (tmean > 0) {
+      res.load_imbalance = tmax / tmean;
+    }
+    return res;
+  }  // end of gatherResults
+
+  /*!
+   * \brief call the given function and store the elapsed time.
+   * \param[out] t: elapsed time, in seconds
+   * \param[in] f: function
+   */
+  template <typename Function>
+  static BehaviourIntegrationResult executeTimedTask(real& t,
+                                                     const Function& f) {
+    const auto start = std::chrono::steady_clock::now();
+    auto r = f();
+    const auto end = std::chrono::steady_clock::now();
+    t = std::chrono::duration<real>(end - start).count();
+    return r;
+  }  // end of executeTimedTask
+
+  /*!
+   * \brief data shared by the tasks treating a set of integration points.
+   *
+   * The distribution of the integration points between the tasks is
+   * handled by the `mgis::internals::ParallelForState` class (see the
+   * `MGIS/ParallelFor.hxx` header).
+   */
+  struct MultiThreadedExecutionState {
+    /*!
+     * \brief constructor
+     * \param[in] b: boundaries of the blocks
+     * \param[in] s: scheduling options
+     * \param[in] sf: stop on failure
+     */
+    MultiThreadedExecutionState(std::vector<size_type> b,
+                                const SchedulingOptions& s,
+                                const bool sf)
+        : parallel_for_state(
+              std::make_shared<mgis::internals::ParallelForState>(
+                  std::move(b), s)),
+          stop_on_failure(sf),
+          times(parallel_for_state->getNumberOfBlocks(), real{0}) {}
+    //! \brief distribution of the integration points between the tasks
+    const std::shared_ptr<mgis::internals::ParallelForState>
+        parallel_for_state;
+    /*!
+     * \brief if true, all tasks stop claiming chunks as soon as the treatment
+     * of one chunk failed.
+     */
+    const bool stop_on_failure;
+    //! \brief time spent by each task
+    std::vector<real> times;
+  };  // end of struct MultiThreadedExecutionState
+
+  /*!
+   * \brief add to the thread pool the tasks treating a set of integration
+   * points.
+   * \return the tasks
+   * \param[in,out] p: thread pool
+   * \param[in] s: shared state
+   * \param[in] f: function treating a range of integration points. This
+   * function takes the index of the worker as first argument.
+   *
+   * \note the tasks hold a copy of the given function and share the
+   * ownership of the shared state, so that the tasks can outlive the caller.
+   */
+  template <typename Task>
+  static std::vector<ThreadedBehaviourIntegrationTask> launchMultiThreaded(
+      ThreadPool& p,
+      const std::shared_ptr<MultiThreadedExecutionState>& s,
+      const Task& f) {
+    return mgis::internals::launchParallelTasks(
+        p, s->parallel_for_state,
+        [s, f](mgis::internals::ParallelForState& st, const size_type i,
+               const size_type w) {
+          return executeTimedTask(s->times[i], [&s, &st, &f, i, w] {
+            auto res = BehaviourIntegrationResult{};
+            st.treat(i, [&s, &res, &f, w](const size_type b,
+                                          const size_type e) {
+              const auto ri = f(w, b, e);
+              mergeBehaviourIntegrationResults(res, ri);
+              return !((s->stop_on_failure) && (ri.exit_status == -1));
+            });
+            // chunks are not treated in order
+            sortBehaviourIntegrationResult(res);
+            return res;
+          });
+        });
+  }  // end of launchMultiThreaded
+
+  /*!
+   * \brief create the state shared by the tasks treating a set of
+   * integration points.
+   * \param[in] blocks: boundaries of the blocks associated with each thread
+   * \param[in] s: scheduling options
+   * \param[in] stop_on_failure: if true, the treatment stops as soon as one
+   * failure is detected. This parameter is only meaningful for the
+   * `WORK_STEALING` policy.
+   */
+  static std::shared_ptr<MultiThreadedExecutionState>
+  makeMultiThreadedExecutionState(std::vector<size_type> blocks,
+                                  const SchedulingOptions& s,
+                                  const bool stop_on_failure) {
+    return std::make_shared<MultiThreadedExecutionState>(std::move(blocks), s,
+                                                         stop_on_failure);
+  }  // end of makeMultiThreadedExecutionState
+
+  /*!
+   * \brief distribute the treatment of a set of integration points between
+   * the threads of a thread pool.
+   * \param[in,out] p: thread pool
+   * \param[in] blocks: boundaries of the blocks associated with each thread
+   * \param[in] s: scheduling options
+   * \param[in] f: function treating a range of integration points. This
+   * function takes the index of the worker as first argument.
+   * \param[in] stop_on_failure: if true, the treatment stops as soon as one
+   * failure is detected. This parameter is only meaningful for the
+   * `WORK_STEALING` policy.
+   */
+  template <typename Task>
+  static MultiThreadedBehaviourIntegrationResult executeMultiThreaded(
+      ThreadPool& p,
+      const std::vector<size_type>& blocks,
+      const SchedulingOptions& s,
+      const Task& f,
+      const bool stop_on_failure = true) {
+    const auto state =
+        makeMultiThreadedExecutionState(blocks, s, stop_on_failure);
+    auto tasks = launchMultiThreaded(p, state, f);
+    return gatherResults(tasks, state->times);
+  }  // end of executeMultiThreaded
+
+  /*!
+   * \brief distribute the treatment of `n` integration points between the
+   * threads of a thread pool.
+   * \param[in,out] p: thread pool
+   * \param[in] n: number of integration points
+   * \param[in] s: scheduling options
+   * \param[in] f: function treating a range of integration points. This
+   * function takes the index of the worker as first argument.
+   */
+  template <typename Task>
+  static MultiThreadedBehaviourIntegrationResult executeMultiThreaded(
+      ThreadPool& p,
+      const size_type n,
+      const SchedulingOptions& s,
+      const Task& f) {
+    const auto blocks = getUniformPartition(n, p.getNumberOfThreads());
+    return executeMultiThreaded(p, blocks, s, f);
+  }  // end of executeMultiThreaded
+
 }  // namespace mgis::behaviour::internals
 
 namespace mgis::behaviour {
@@ -425,6 +1276,47 @@ namespace mgis::behaviour {
   MultiThreadedBehaviourIntegrationResult::
       ~MultiThreadedBehaviourIntegrationResult() = default;
 
+  mgis::real getNumberOfIntegrationPointsPerSecond(
+      const BehaviourIntegrationProfile& p) {
+    if (!(p.wall_time > 0)) {
+      return 0;
+    }
+    return static_cast<real>(p.number_of_integration_points) / p.wall_time;
+  }  // end of getNumberOfIntegrationPointsPerSecond
+
+  void print_markdown(std::ostream& os,
+                      const BehaviourIntegrationProfile& p,
+                      const mgis::size_type l) {
+    const auto& bounds = BehaviourIntegrationProfile::rdt_histogram_bounds;
+    const auto other_time =
+        std::max(p.wall_time - p.data_access_time - p.behaviour_time, real{0});
+    os << "- number of integration points: " << p.number_of_integration_points
+       << '\n'
+       << "- number of unreliable results: " << p.number_of_unreliable_results
+       << '\n'
+       << "- number of failures: " << p.number_of_failures << '\n'
+       << "- wall time: " << p.wall_time << " s\n"
+       << "- integration points per second: "
+       << getNumberOfIntegrationPointsPerSecond(p) << '\n'
+       << "- time spent in the behaviour: " << p.behaviour_time << " s\n"
+       << "- time spent in accessing the data: " << p.data_access_time
+       << " s\n"
+       << "- other time: " << other_time << " s\n\n";
+    os << mgis::utilities::get_heading_signs(l + 1)
+       << " Histogram of the time step increase factors\n\n";
+    for (size_type i = 0; i != p.rdt_histogram.size(); ++i) {
+      if (i == 0) {
+        os << "- rdt < " << bounds[0];
+      } else if (i == bounds.size()) {
+        os << "- rdt >= " << bounds[i - 1];
+      } else {
+        os << "- " << bounds[i - 1] << " <= rdt < " << bounds[i];
+      }
+      os << ": " << p.rdt_histogram[i] << '\n';
+    }
+    os << '\n';
+  }  // end of print_markdown
+
   static const BehaviourInitializeFunction& getBehaviourInitializeFunction(
       const Behaviour& b, const std::string_view n) {
     const auto p = b.initialize_functions.find(n);
@@ -479,7 +1371,9 @@ namespace mgis::behaviour {
           "invalid size of the inputs '" +
           std::string{n} + "'");
     }
-    return internals::executeInitializeFunction(m, ifct, b, e);
+    const auto gp = m.getGatherPlan();
+    return internals::executeInitializeFunction(
+        m.getBehaviourIntegrationWorkSpace(), *gp, m, ifct, b, e);
   }  // end of executeInitializeFunction
 
   BehaviourIntegrationResult executeInitializeFunction(
@@ -497,10 +1391,14 @@ namespace mgis::behaviour {
           "invalid size of the inputs '" +
           std::string{n} + "'");
     }
+    const auto gp = m.getGatherPlan();
     if (inputs.size() == istride) {
-      return internals::executeInitializeFunction(m, ifct, inputs, 0, b, e);
+      return internals::executeInitializeFunction(
+          m.getBehaviourIntegrationWorkSpace(), *gp, m, ifct, inputs, 0, b, e);
     }
-    return internals::executeInitializeFunction(m, ifct, inputs, istride, b, e);
+    return internals::executeInitializeFunction(
+        m.getBehaviourIntegrationWorkSpace(), *gp, m, ifct, inputs, istride, b,
+        e);
   }  // end of executeInitializeFunction
 
   BehaviourIntegrationResult executeInitializeFunction(
@@ -516,10 +1414,16 @@ namespace mgis::behaviour {
     return executeInitializeFunction(m, n, inputs, 0, m.n);
   }  // end of executeInitializeFunction
 
+  MultiThreadedBehaviourIntegrationResult executeInitializeFunction(
+      ThreadPool& p, MaterialDataManager& m, const std::string_view n) {
+    return executeInitializeFunction(p, m, n, SchedulingOptions{});
+  }  // end of executeInitializeFunction
+
   MultiThreadedBehaviourIntegrationResult executeInitializeFunction(
       ThreadPool& p,
       MaterialDataManager& m,
-      const std::string_view n) {
+      const std::string_view n,
+      const SchedulingOptions& s) {
     const auto& ifct = getBehaviourInitializeFunction(m.b, n);
     if (!ifct.inputs.empty()) {
       mgis::raise(
@@ -528,33 +1432,15 @@ namespace mgis::behaviour {
           std::string{n} + "'");
     }
     m.setThreadSafe(true);
-    // get number of threads
-    const auto nth = p.getNumberOfThreads();
-    const auto d = m.n / nth;
-    const auto r = m.n % nth;
-    size_type b = 0;
-    std::vector<std::future<ThreadedTaskResult<BehaviourIntegrationResult>>>
-        tasks;
-    tasks.reserve(nth);
-    for (size_type i = 0; i != r; ++i) {
-      tasks.push_back(p.addTask([&m, &ifct, b, d] {
-        return internals::executeInitializeFunction(m, ifct, b, b + d + 1);
-      }));
-      b += d + 1;
-    }
-    for (size_type i = r; i != nth; ++i) {
-      tasks.push_back(p.addTask([&m, &ifct, b, d] {
-        return internals::executeInitializeFunction(m, ifct, b, b + d);
-      }));
-      b += d;
-    }
-    auto res = MultiThreadedBehaviourIntegrationResult{};
-    for (auto& t : tasks) {
-      const auto& ri = *(t.get());
-      res.exit_status = std::min(res.exit_status, ri.exit_status);
-      res.results.push_back(ri);
-    }
-    return res;
+    m.reserveBehaviourIntegrationWorkSpaces(p.getNumberOfThreads());
+    const auto gp = m.getGatherPlan();
+    return internals::executeMultiThreaded(
+        p, m.n, s,
+        [&m, &gp, &ifct](const size_type w, const size_type b,
+                         const size_type e) {
+          return internals::executeInitializeFunction(
+              m.getBehaviourIntegrationWorkSpace(w), *gp, m, ifct, b, e);
+        });
   }  // end of executeInitializeFunction
 
   MultiThreadedBehaviourIntegrationResult executeInitializeFunction(
@@ -562,6 +1448,15 @@ namespace mgis::behaviour {
       MaterialDataManager& m,
       const std::string_view n,
       mgis::span<const real> inputs) {
+    return executeInitializeFunction(p, m, n, inputs, SchedulingOptions{});
+  }  // end of executeInitializeFunction
+
+  MultiThreadedBehaviourIntegrationResult executeInitializeFunction(
+      ThreadPool& p,
+      MaterialDataManager& m,
+      const std::string_view n,
+      mgis::span<const real> inputs,
+      const SchedulingOptions& s) {
     const auto& ifct = getBehaviourInitializeFunction(m.b, n);
     const auto istride = getArraySize(ifct.inputs, m.b.hypothesis);
     if ((inputs.size() != m.n * istride) && (inputs.size() != istride)) {
@@ -573,35 +1468,156 @@ namespace mgis::behaviour {
     // effective stride
     const auto estride = (inputs.size() == istride) ? 0 : istride;
     m.setThreadSafe(true);
-    // get number of threads
-    const auto nth = p.getNumberOfThreads();
-    const auto d = m.n / nth;
-    const auto r = m.n % nth;
-    size_type b = 0;
-    std::vector<std::future<ThreadedTaskResult<BehaviourIntegrationResult>>>
-        tasks;
-    tasks.reserve(nth);
-    for (size_type i = 0; i != r; ++i) {
-      tasks.push_back(p.addTask([&inputs, &m, &ifct, estride, b, d] {
-        return internals::executeInitializeFunction(m, ifct, inputs, estride, b,
-                                                    b + d + 1);
-      }));
-      b += d + 1;
-    }
-    for (size_type i = r; i != nth; ++i) {
-      tasks.push_back(p.addTask([&inputs, &m, &ifct, estride, b, d] {
-        return internals::executeInitializeFunction(m, ifct, inputs, estride, b,
-                                                    b + d);
-      }));
-      b += d;
+    m.reserveBehaviourIntegrationWorkSpaces(p.getNumberOfThreads());
+    const auto gp = m.getGatherPlan();
+    return internals::executeMultiThreaded(
+        p, m.n, s,
+        [&inputs, &m, &gp, &ifct, estride](
+            const size_type w, const size_type b, const size_type e) {
+          return internals::executeInitializeFunction(
+              m.getBehaviourIntegrationWorkSpace(w), *gp, m, ifct, inputs,
+              estride, b, e);
+        });
+  }  // end of executeInitializeFunction
+
+  BehaviourIntegrationResult executeInitializeFunction(
+      MaterialDataManager& m,
+      const std::string_view n,
+      mgis::span<const size_type> indices) {
+    const auto& ifct = getBehaviourInitializeFunction(m.b, n);
+    if (!ifct.inputs.empty()) {
+      mgis::raise(
+          "executeInitializeFunction: "
+          "invalid size of the inputs '" +
+          std::string{n} + "'");
     }
-    auto res = MultiThreadedBehaviourIntegrationResult{};
-    for (auto& t : tasks) {
-      const auto& ri = *(t.get());
-      res.exit_status = std::min(res.exit_status, ri.exit_status);
-      res.results.push_back(ri);
+    internals::checkIntegrationPointsIndices(m, indices);
+    const auto gp = m.getGatherPlan();
+    auto r = internals::executeInitializeFunction(
+        m.getBehaviourIntegrationWorkSpace(), *gp, m, ifct, 0, indices.size(),
+        internals::IndexedIntegrationPoints{indices});
+    internals::sortBehaviourIntegrationResult(r);
+    return r;
+  }  // end of executeInitializeFunction
+
+  BehaviourIntegrationResult executeInitializeFunction(
+      MaterialDataManager& m,
+      const std::string_view n,
+      mgis::span<const real> inputs,
+      mgis::span<const size_type> indices) {
+    const auto& ifct = getBehaviourInitializeFunction(m.b, n);
+    const auto istride = getArraySize(ifct.inputs, m.b.hypothesis);
+    if ((inputs.size() != m.n * istride) && (inputs.size() != istride)) {
+      mgis::raise(
+          "executeInitializeFunction: "
+          "invalid size of the inputs '" +
+          std::string{n} + "'");
     }
-    return res;
+    internals::checkIntegrationPointsIndices(m, indices);
+    // effective stride
+    const auto estride = (inputs.size() == istride) ? 0 : istride;
+    const auto gp = m.getGatherPlan();
+    auto r = internals::executeInitializeFunction(
+        m.getBehaviourIntegrationWorkSpace(), *gp, m, ifct, inputs, estride, 0,
+        indices.size(), internals::IndexedIntegrationPoints{indices});
+    internals::sortBehaviourIntegrationResult(r);
+    return r;
+  }  // end of executeInitializeFunction
+
+  BehaviourIntegrationResult executeInitializeFunction(
+      MaterialDataManager& m,
+      const std::string_view n,
+      const std::vector<bool>& mask) {
+    const auto indices = internals::getIntegrationPointsIndices(m, mask);
+    return executeInitializeFunction(m, n, indices);
+  }  // end of executeInitializeFunction
+
+  BehaviourIntegrationResult executeInitializeFunction(
+      MaterialDataManager& m,
+      const std::string_view n,
+      mgis::span<const real> inputs,
+      const std::vector<bool>& mask) {
+    const auto indices = internals::getIntegrationPointsIndices(m, mask);
+    return executeInitializeFunction(m, n, inputs, indices);
+  }  // end of executeInitializeFunction
+
+  MultiThreadedBehaviourIntegrationResult executeInitializeFunction(
+      ThreadPool& p,
+      MaterialDataManager& m,
+      const std::string_view n,
+      mgis::span<const size_type> indices,
+      const SchedulingOptions& s) {
+    const auto& ifct = getBehaviourInitializeFunction(m.b, n);
+    if (!ifct.inputs.empty()) {
+      mgis::raise(
+          "executeInitializeFunction: "
+          "invalid size of the inputs '" +
+          std::string{n} + "'");
+    }
+    internals::checkIntegrationPointsIndices(m, indices);
+    m.setThreadSafe(true);
+    m.reserveBehaviourIntegrationWorkSpaces(p.getNumberOfThreads());
+    const auto gp = m.getGatherPlan();
+    return internals::executeMultiThreaded(
+        p, indices.size(), s,
+        [&m, &gp, &ifct, indices](const size_type w, const size_type b,
+                                  const size_type e) {
+          return internals::executeInitializeFunction(
+              m.getBehaviourIntegrationWorkSpace(w), *gp, m, ifct, b, e,
+              internals::IndexedIntegrationPoints{indices});
+        });
+  }  // end of executeInitializeFunction
+
+  MultiThreadedBehaviourIntegrationResult executeInitializeFunction(
+      ThreadPool& p,
+      MaterialDataManager& m,
+      const std::string_view n,
+      mgis::span<const real> inputs,
+      mgis::span<const size_type> indices,
+      const SchedulingOptions& s) {
+    const auto& ifct = getBehaviourInitializeFunction(m.b, n);
+    const auto istride = getArraySize(ifct.inputs, m.b.hypothesis);
+    if ((inputs.size() != m.n * istride) && (inputs.size() != istride)) {
+      mgis::raise(
+          "executeInitializeFunction: "
+          "invalid size of the inputs '" +
+          std::string{n} + "'");
+    }
+    internals::checkIntegrationPointsIndices(m, indices);
+    // effective stride
+    const auto estride = (inputs.size() == istride) ? 0 : istride;
+    m.setThreadSafe(true);
+    m.reserveBehaviourIntegrationWorkSpaces(p.getNumberOfThreads());
+    const auto gp = m.getGatherPlan();
+    return internals::executeMultiThreaded(
+        p, indices.size(), s,
+        [&inputs, &m, &gp, &ifct, estride, indices](
+            const size_type w, const size_type b, const size_type e) {
+          return internals::executeInitializeFunction(
+              m.getBehaviourIntegrationWorkSpace(w), *gp, m, ifct, inputs,
+              estride, b, e, internals::IndexedIntegrationPoints{indices});
+        });
+  }  // end of executeInitializeFunction
+
+  MultiThreadedBehaviourIntegrationResult executeInitializeFunction(
+      ThreadPool& p,
+      MaterialDataManager& m,
+      const std::string_view n,
+      const std::vector<bool>& mask,
+      const SchedulingOptions& s) {
+    const auto indices = internals::getIntegrationPointsIndices(m, mask);
+    return executeInitializeFunction(p, m, n, indices, s);
+  }  // end of executeInitializeFunction
+
+  MultiThreadedBehaviourIntegrationResult executeInitializeFunction(
+      ThreadPool& p,
+      MaterialDataManager& m,
+      const std::string_view n,
+      mgis::span<const real> inputs,
+      const std::vector<bool>& mask,
+      const SchedulingOptions& s) {
+    const auto indices = internals::getIntegrationPointsIndices(m, mask);
+    return executeInitializeFunction(p, m, n, inputs, indices, s);
   }  // end of executeInitializeFunction
 
   int integrate(MaterialDataManager& m,
@@ -622,7 +1638,9 @@ namespace mgis::behaviour {
                                        const size_type e) {
     internals::allocate(m, opts);
     internals::checkIntegrationPointsRange(m, b, e);
-    return internals::integrate(m, opts, dt, b, e);
+    const auto gp = m.getGatherPlan();
+    return internals::integrate(m.getBehaviourIntegrationWorkSpace(), *gp, m,
+                                opts, dt, b, e);
   }  // end of integrate
 
   int integrate(ThreadPool& p,
@@ -642,52 +1660,181 @@ namespace mgis::behaviour {
       const real dt) {
     m.setThreadSafe(true);
     internals::allocate(m, opts);
-    // get number of threads
     const auto nth = p.getNumberOfThreads();
-    const auto d = m.n / nth;
-    const auto r = m.n % nth;
-    size_type b = 0;
-    std::vector<std::future<ThreadedTaskResult<BehaviourIntegrationResult>>>
-        tasks;
-    tasks.reserve(nth);
-    for (size_type i = 0; i != r; ++i) {
-      tasks.push_back(p.addTask([&m, &opts, dt, b, d] {
-        return internals::integrate(m, opts, dt, b, b + d + 1);
-      }));
-      b += d + 1;
-    }
-    for (size_type i = r; i != nth; ++i) {
-      tasks.push_back(p.addTask([&m, &opts, dt, b, d] {
-        return internals::integrate(m, opts, dt, b, b + d);
-      }));
-      b += d;
+    m.reserveBehaviourIntegrationWorkSpaces(nth);
+    const auto blocks =
+        m.integration_costs.empty()
+            ? getUniformPartition(m.n, nth)
+            : getCostBasedPartition(m.integration_costs, nth);
+    const auto gp = m.getGatherPlan();
+    return internals::executeMultiThreaded(
+        p, blocks, opts.scheduling,
+        [&m, &gp, &opts, dt](const size_type w, const size_type b,
+                             const size_type e) {
+          return internals::integrate(m.getBehaviourIntegrationWorkSpace(w),
+                                      *gp, m, opts, dt, b, e);
+        },
+        opts.stop_on_failure);
+  }  // end of integrate
+
+  BehaviourIntegrationResult integrate(MaterialDataManager& m,
+                                       const BehaviourIntegrationOptions& opts,
+                                       const real dt,
+                                       mgis::span<const size_type> indices) {
+    internals::allocate(m, opts);
+    internals::checkIntegrationPointsIndices(m, indices);
+    const auto gp = m.getGatherPlan();
+    auto r = internals::integrate(
+        m.getBehaviourIntegrationWorkSpace(), *gp, m, opts, dt, 0,
+        indices.size(), internals::IndexedIntegrationPoints{indices});
+    internals::sortBehaviourIntegrationResult(r);
+    return r;
+  }  // end of integrate
+
+  BehaviourIntegrationResult integrate(MaterialDataManager& m,
+                                       const BehaviourIntegrationOptions& opts,
+                                       const real dt,
+                                       const std::vector<bool>& mask) {
+    const auto indices = internals::getIntegrationPointsIndices(m, mask);
+    return integrate(m, opts, dt, indices);
+  }  // end of integrate
+
+  MultiThreadedBehaviourIntegrationResult integrate(
+      ThreadPool& p,
+      MaterialDataManager& m,
+      const BehaviourIntegrationOptions& opts,
+      const real dt,
+      mgis::span<const size_type> indices) {
+    internals::checkIntegrationPointsIndices(m, indices);
+    m.setThreadSafe(true);
+    internals::allocate(m, opts);
+    const auto nth = p.getNumberOfThreads();
+    m.reserveBehaviourIntegrationWorkSpaces(nth);
+    const auto blocks = [&m, indices, nth] {
+      if (m.integration_costs.empty()) {
+        return getUniformPartition(indices.size(), nth);
+      }
+      // costs of the selected integration points
+      auto costs = std::vector<real>{};
+      costs.reserve(indices.size());
+      for (const auto i : indices) {
+        costs.push_back(m.integration_costs[i]);
+      }
+      return getCostBasedPartition(costs, nth);
+    }();
+    const auto gp = m.getGatherPlan();
+    return internals::executeMultiThreaded(
+        p, blocks, opts.scheduling,
+        [&m, &gp, &opts, dt, indices](const size_type w, const size_type b,
+                                      const size_type e) {
+          return internals::integrate(
+              m.getBehaviourIntegrationWorkSpace(w), *gp, m, opts, dt, b, e,
+              internals::IndexedIntegrationPoints{indices});
+        },
+        opts.stop_on_failure);
+  }  // end of integrate
+
+  MultiThreadedBehaviourIntegrationResult integrate(
+      ThreadPool& p,
+      MaterialDataManager& m,
+      const BehaviourIntegrationOptions& opts,
+      const real dt,
+      const std::vector<bool>& mask) {
+    const auto indices = internals::getIntegrationPointsIndices(m, mask);
+    return integrate(p, m, opts, dt, indices);
+  }  // end of integrate
+
+  AsynchronousBehaviourIntegration::AsynchronousBehaviourIntegration(
+      std::shared_ptr<internals::MultiThreadedExecutionState> s,
+      std::vector<Task> t)
+      : state(std::move(s)), tasks(std::move(t)) {
+  }  // end of AsynchronousBehaviourIntegration
+
+  AsynchronousBehaviourIntegration::AsynchronousBehaviourIntegration(
+      AsynchronousBehaviourIntegration&&) = default;
+
+  AsynchronousBehaviourIntegration& AsynchronousBehaviourIntegration::
+  operator=(AsynchronousBehaviourIntegration&& src) {
+    if (this != &src) {
+      this->wait();
+      this->state = std::move(src.state);
+      this->tasks = std::move(src.tasks);
     }
-    auto res = MultiThreadedBehaviourIntegrationResult{};
-    for (auto& t : tasks) {
-      const auto& ri = *(t.get());
-      res.exit_status = std::min(res.exit_status, ri.exit_status);
-      res.results.push_back(ri);
+    return *this;
+  }  // end of operator=
+
+  bool AsynchronousBehaviourIntegration::poll() const {
+    for (const auto& t : this->tasks) {
+      if ((t.valid()) && (t.wait_for(std::chrono::seconds(0)) !=
+                          std::future_status::ready)) {
+        return false;
+      }
     }
-    return res;
-  }  // end of integrate
+    return true;
+  }  // end of poll
 
-  static const BehaviourPostProcessing& getBehaviourPostProcessing(
-      const Behaviour& b, const std::string_view n) {
-    const auto p = b.postprocessings.find(n);
-    if (p == b.postprocessings.end()) {
+  void AsynchronousBehaviourIntegration::wait() const {
+    for (const auto& t : this->tasks) {
+      if (t.valid()) {
+        t.wait();
+      }
+    }
+  }  // end of wait
+
+  MultiThreadedBehaviourIntegrationResult
+  AsynchronousBehaviourIntegration::get() {
+    if ((this->state == nullptr) || (this->tasks.empty()) ||
+        (!this->tasks.front().valid())) {
       mgis::raise(
-          "getBehaviourPostProcessing: "
-          "no postprocessing named '" +
-          std::string{n} + "'");
+          "AsynchronousBehaviourIntegration::get: "
+          "the result has already been retrieved");
     }
-    return p->second;
-  }  // end of getBehaviourPostProcessing
+    return internals::gatherResults(this->tasks, this->state->times);
+  }  // end of get
+
+  AsynchronousBehaviourIntegration::~AsynchronousBehaviourIntegration() {
+    this->wait();
+  }  // end of ~AsynchronousBehaviourIntegration
+
+  AsynchronousBehaviourIntegration integrateAsynchronously(
+      ThreadPool& p,
+      MaterialDataManager& m,
+      const BehaviourIntegrationOptions& opts,
+      const real dt,
+      BehaviourIntegrationChunkCallback f) {
+    m.setThreadSafe(true);
+    internals::allocate(m, opts);
+    const auto nth = p.getNumberOfThreads();
+    m.reserveBehaviourIntegrationWorkSpaces(nth);
+    auto blocks =
+        m.integration_costs.empty()
+            ? getUniformPartition(m.n, nth)
+            : getCostBasedPartition(m.integration_costs, nth);
+    const auto gp = m.getGatherPlan();
+    auto state = internals::makeMultiThreadedExecutionState(
+        std::move(blocks), opts.scheduling, opts.stop_on_failure);
+    // the function passed to the tasks holds copies of the options, of the
+    // gather plan and of the callback, since the tasks outlive this call
+    auto tasks = internals::launchMultiThreaded(
+        p, state,
+        [&m, gp, opts, dt, f](const size_type w, const size_type b,
+                              const size_type e) {
+          auto r = internals::integrate(m.getBehaviourIntegrationWorkSpace(w),
+                                        *gp, m, opts, dt, b, e);
+          if (f) {
+            f(b, e, r);
+          }
+          return r;
+        });
+    return AsynchronousBehaviourIntegration(std::move(state),
+                                            std::move(tasks));
+  }  // end of integrateAsynchronously
 
   int executePostProcessing(mgis::span<real> outputs,
                             BehaviourDataView& d,
                             const Behaviour& b,
                             const std::string_view n) {
-    const auto& p = getBehaviourPostProcessing(b, n);
+    const auto& p = internals::getBehaviourPostProcessing(b, n);
     if (outputs.size() != getArraySize(p.outputs, b.hypothesis)) {
       mgis::raise(
           "executePostProcessing: "
@@ -702,7 +1849,7 @@ namespace mgis::behaviour {
                                                    const std::string_view n,
                                                    const size_type b,
                                                    const size_type e) {
-    const auto& p = getBehaviourPostProcessing(m.b, n);
+    const auto& p = internals::getBehaviourPostProcessing(m.b, n);
     const auto ostride = getArraySize(p.outputs, m.b.hypothesis);
     internals::checkIntegrationPointsRange(m, b, e);
     if (outputs.size() != m.n * ostride) {
@@ -711,7 +1858,9 @@ namespace mgis::behaviour {
           "invalid size of the outputs '" +
           std::string{n} + "'");
     }
-    return internals::executePostProcessing(outputs, m, p, ostride, b, e);
+    const auto gp = m.getGatherPlan();
+    return internals::executePostProcessing(
+        m.getBehaviourIntegrationWorkSpace(), *gp, outputs, m, p, ostride, b, e);
   }  // end of executePostProcessing
 
   BehaviourIntegrationResult executePostProcessing(mgis::span<real> outputs,
@@ -725,7 +1874,16 @@ namespace mgis::behaviour {
       ThreadPool& p,
       MaterialDataManager& m,
       const std::string_view n) {
-    const auto& post = getBehaviourPostProcessing(m.b, n);
+    return executePostProcessing(outputs, p, m, n, SchedulingOptions{});
+  }  // end of executePostProcessing
+
+  MultiThreadedBehaviourIntegrationResult executePostProcessing(
+      mgis::span<real> outputs,
+      ThreadPool& p,
+      MaterialDataManager& m,
+      const std::string_view n,
+      const SchedulingOptions& s) {
+    const auto& post = internals::getBehaviourPostProcessing(m.b, n);
     const auto ostride = getArraySize(post.outputs, m.b.hypothesis);
     if (outputs.size() != m.n * ostride) {
       mgis::raise(
@@ -734,35 +1892,87 @@ namespace mgis::behaviour {
           std::string{n} + "'");
     }
     m.setThreadSafe(true);
-    // get number of threads
-    const auto nth = p.getNumberOfThreads();
-    const auto d = m.n / nth;
-    const auto r = m.n % nth;
-    size_type b = 0;
-    std::vector<std::future<ThreadedTaskResult<BehaviourIntegrationResult>>>
-        tasks;
-    tasks.reserve(nth);
-    for (size_type i = 0; i != r; ++i) {
-      tasks.push_back(p.addTask([&outputs, &m, &post, ostride, b, d] {
-        return internals::executePostProcessing(outputs, m, post, ostride, b,
-                                                b + d + 1);
-      }));
-      b += d + 1;
-    }
-    for (size_type i = r; i != nth; ++i) {
-      tasks.push_back(p.addTask([&outputs, &m, &post, ostride, b, d] {
-        return internals::executePostProcessing(outputs, m, post, ostride, b,
-                                                b + d);
-      }));
-      b += d;
+    m.reserveBehaviourIntegrationWorkSpaces(p.getNumberOfThreads());
+    const auto gp = m.getGatherPlan();
+    return internals::executeMultiThreaded(
+        p, m.n, s,
+        [&outputs, &m, &gp, &post, ostride](
+            const size_type w, const size_type b, const size_type e) {
+          return internals::executePostProcessing(
+              m.getBehaviourIntegrationWorkSpace(w), *gp, outputs, m, post,
+              ostride, b, e);
+        });
+  }  // end of executePostProcessing
+
+  BehaviourIntegrationResult executePostProcessing(
+      mgis::span<real> outputs,
+      MaterialDataManager& m,
+      const std::string_view n,
+      mgis::span<const size_type> indices) {
+    const auto& p = internals::getBehaviourPostProcessing(m.b, n);
+    const auto ostride = getArraySize(p.outputs, m.b.hypothesis);
+    internals::checkIntegrationPointsIndices(m, indices);
+    if (outputs.size() != m.n * ostride) {
+      mgis::raise(
+          "executePostProcessing: "
+          "invalid size of the outputs '" +
+          std::string{n} + "'");
     }
-    auto res = MultiThreadedBehaviourIntegrationResult{};
-    for (auto& t : tasks) {
-      const auto& ri = *(t.get());
-      res.exit_status = std::min(res.exit_status, ri.exit_status);
-      res.results.push_back(ri);
+    const auto gp = m.getGatherPlan();
+    auto r = internals::executePostProcessing(
+        m.getBehaviourIntegrationWorkSpace(), *gp, outputs, m, p, ostride, 0,
+        indices.size(), internals::IndexedIntegrationPoints{indices});
+    internals::sortBehaviourIntegrationResult(r);
+    return r;
+  }  // end of executePostProcessing
+
+  BehaviourIntegrationResult executePostProcessing(
+      mgis::span<real> outputs,
+      MaterialDataManager& m,
+      const std::string_view n,
+      const std::vector<bool>& mask) {
+    const auto indices = internals::getIntegrationPointsIndices(m, mask);
+    return executePostProcessing(outputs, m, n, indices);
+  }  // end of executePostProcessing
+
+  MultiThreadedBehaviourIntegrationResult executePostProcessing(
+      mgis::span<real> outputs,
+      ThreadPool& p,
+      MaterialDataManager& m,
+      const std::string_view n,
+      mgis::span<const size_type> indices,
+      const SchedulingOptions& s) {
+    const auto& post = internals::getBehaviourPostProcessing(m.b, n);
+    const auto ostride = getArraySize(post.outputs, m.b.hypothesis);
+    internals::checkIntegrationPointsIndices(m, indices);
+    if (outputs.size() != m.n * ostride) {
+      mgis::raise(
+          "executePostProcessing: "
+          "invalid size of the outputs '" +
+          std::string{n} + "'");
     }
-    return res;
+    m.setThreadSafe(true);
+    m.reserveBehaviourIntegrationWorkSpaces(p.getNumberOfThreads());
+    const auto gp = m.getGatherPlan();
+    return internals::executeMultiThreaded(
+        p, indices.size(), s,
+        [&outputs, &m, &gp, &post, ostride, indices](
+            const size_type w, const size_type b, const size_type e) {
+          return internals::executePostProcessing(
+              m.getBehaviourIntegrationWorkSpace(w), *gp, outputs, m, post,
+              ostride, b, e, internals::IndexedIntegrationPoints{indices});
+        });
+  }  // end of executePostProcessing
+
+  MultiThreadedBehaviourIntegrationResult executePostProcessing(
+      mgis::span<real> outputs,
+      ThreadPool& p,
+      MaterialDataManager& m,
+      const std::string_view n,
+      const std::vector<bool>& mask,
+      const SchedulingOptions& s) {
+    const auto indices = internals::getIntegrationPointsIndices(m, mask);
+    return executePostProcessing(outputs, p, m, n, indices, s);
   }  // end of executePostProcessing
 
 }  // end of namespace mgis::behaviour
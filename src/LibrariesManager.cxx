@@ -12,6 +12,7 @@
  *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
  */
 
+#include <mutex>
 #include <cctype>
 #include <cstring>
 #include <iterator>
@@ -196,6 +197,10 @@ namespace mgis {
 
   LibrariesManager::LibrariesManager() = default;
 
+  void LibrariesManager::preloadLibrary(const std::string &l) {
+    this->loadLibrary(l);
+  }  // end of preloadLibrary
+
   std::vector<std::string> LibrariesManager::getBehaviourInitializeFunctions(
       const std::string &l, const std::string &b, const Hypothesis h) {
     return this->getNames(l, b, h, "InitializeFunctions");
@@ -581,6 +586,30 @@ namespace mgis {
     return *(static_cast<const char *const *>(p));
   }  // end of getSource
 
+  std::string LibrariesManager::getLibraryPath(const std::string &l,
+                                               const std::string &n) {
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+    static_cast<void>(n);
+    char path[MAX_PATH];
+    const auto s =
+        ::GetModuleFileNameA(this->loadLibrary(l).handler, path, MAX_PATH);
+    if ((s == 0) || (s == MAX_PATH)) {
+      return "";
+    }
+    return std::string(path, s);
+#else  /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)*/
+    const auto p = this->getSymbolAddress(l, n + "_mfront_mkt");
+    if (p == nullptr) {
+      return "";
+    }
+    Dl_info info;
+    if ((::dladdr(p, &info) == 0) || (info.dli_fname == nullptr)) {
+      return "";
+    }
+    return info.dli_fname;
+#endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
+  }  // end of getLibraryPath
+
   std::string LibrariesManager::getInterface(const std::string &l,
                                              const std::string &n) {
     const auto p = this->getSymbolAddress(l, n + "_mfront_interface");
@@ -803,12 +832,26 @@ namespace mgis {
 
   void *LibrariesManager::getSymbolAddress(const std::string &l,
                                            const std::string &n) {
-    auto lib = this->loadLibrary(l);
+    auto &lib = this->loadLibrary(l);
+    // the result of the lookup is cached, even if the symbol is not found,
+    // since the `load` function queries many optional symbols
+    {
+      std::shared_lock<std::shared_mutex> lock(lib.m);
+      const auto p = lib.symbols.find(n);
+      if (p != lib.symbols.end()) {
+        return p->second;
+      }
+    }
+    // the symbol is looked for without holding the lock: dlsym and
+    // GetProcAddress are thread-safe
 #if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
-    return reinterpret_cast<void *>(::GetProcAddress(lib, n.c_str()));
+    const auto ptr =
+        reinterpret_cast<void *>(::GetProcAddress(lib.handler, n.c_str()));
 #else  /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)*/
-    return ::dlsym(lib, n.c_str());
+    const auto ptr = ::dlsym(lib.handler, n.c_str());
 #endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
+    std::unique_lock<std::shared_mutex> lock(lib.m);
+    return lib.symbols.insert({n, ptr}).first->second;
   }    // end of getSymbolAddress
 
   void *LibrariesManager::getSymbolAddress(const std::string &l,
@@ -821,8 +864,17 @@ namespace mgis {
     return p;
   }  // end of getSymbolAddress
 
-  LibrariesManager::libhandler LibrariesManager::loadLibrary(
+  LibrariesManager::Library &LibrariesManager::loadLibrary(
       const std::string &l) {
+    {
+      std::shared_lock<std::shared_mutex> lock(this->m);
+      const auto p = this->libraries.find(l);
+      if (p != this->libraries.end()) {
+        return p->second;
+      }
+    }
+    std::unique_lock<std::shared_mutex> lock(this->m);
+    // the library may have been loaded by another thread in the meantime
     auto p = this->libraries.find(l);
     if (p == this->libraries.end()) {
       // this library has not been
@@ -837,8 +889,7 @@ namespace mgis {
             "(" +
             getErrorMessage() + ")");
       }
-      this->libraries.insert({l, lib});
-      return lib;
+      return this->libraries.try_emplace(l, lib).first->second;
     }
     return p->second;
   }  // end of loadLibrary
@@ -1085,9 +1136,9 @@ namespace mgis {
   LibrariesManager::~LibrariesManager() {
     for (const auto &l : this->libraries) {
 #if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
-      ::FreeLibrary(l.second);
+      ::FreeLibrary(l.second.handler);
 #else  /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
-      ::dlclose(l.second);
+      ::dlclose(l.second.handler);
 #endif /* (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__) */
     }
   }  // end of ~LibrariesManager
@@ -15,6 +15,7 @@
 #include <mutex>
 #include <thread>
 #include "MGIS/Raise.hxx"
+#include "MGIS/ParallelFor.hxx"
 #include "MGIS/Behaviour/Behaviour.hxx"
 #include "MGIS/Behaviour/MaterialDataManager.hxx"
 
@@ -23,6 +24,14 @@ namespace mgis::behaviour {
   BehaviourIntegrationWorkSpace::BehaviourIntegrationWorkSpace(
       const Behaviour& b)
       : error_message(512),
+        gradients0(getArraySize(b.gradients, b.hypothesis)),
+        gradients1(getArraySize(b.gradients, b.hypothesis)),
+        thermodynamic_forces0(
+            getArraySize(b.thermodynamic_forces, b.hypothesis)),
+        thermodynamic_forces1(
+            getArraySize(b.thermodynamic_forces, b.hypothesis)),
+        internal_state_variables0(getArraySize(b.isvs, b.hypothesis)),
+        internal_state_variables1(getArraySize(b.isvs, b.hypothesis)),
         mps0(getArraySize(b.mps, b.hypothesis)),
         mps1(getArraySize(b.mps, b.hypothesis)),
         esvs0(getArraySize(b.esvs, b.hypothesis)),
@@ -44,6 +53,7 @@ namespace mgis::behaviour {
       : s0(behaviour, s),
         s1(behaviour, s),
         n(s),
+        tangent_operator_storage(TangentOperatorStorage::FULL_BLOCKS),
         K_stride(getTangentOperatorArraySize(behaviour)),
         b(behaviour) {}  // end of MaterialDataManager
 
@@ -54,8 +64,16 @@ namespace mgis::behaviour {
       : s0(behaviour, s, i.s0),
         s1(behaviour, s, i.s1),
         n(s),
-        K_stride(getTangentOperatorArraySize(behaviour)),
+        tangent_operator_storage(i.tangent_operator_storage),
+        K_stride(getTangentOperatorArraySize(behaviour,
+                                             i.tangent_operator_storage)),
         b(behaviour) {
+    if (i.s0.precision != i.s1.precision) {
+      mgis::raise(
+          "MaterialDataManager::MaterialDataManager: "
+          "the states at the beginning and at the end of the time step "
+          "must use the same storage precision");
+    }
     if (!i.K.empty()) {
       this->useExternalArrayOfTangentOperatorBlocks(i.K);
     }
@@ -87,6 +105,25 @@ namespace mgis::behaviour {
     this->thread_safe = bv;
   }  // end of setThreadSafe
 
+  void MaterialDataManager::setUpdatePolicy(const UpdatePolicy p) {
+    this->update_policy = p;
+  }  // end of setUpdatePolicy
+
+  MaterialDataManager::UpdatePolicy MaterialDataManager::getUpdatePolicy()
+      const {
+    return this->update_policy;
+  }  // end of getUpdatePolicy
+
+  void MaterialDataManager::setTangentOperatorResetPolicy(
+      const TangentOperatorResetPolicy p) {
+    this->K_reset_policy = p;
+  }  // end of setTangentOperatorResetPolicy
+
+  MaterialDataManager::TangentOperatorResetPolicy
+  MaterialDataManager::getTangentOperatorResetPolicy() const {
+    return this->K_reset_policy;
+  }  // end of getTangentOperatorResetPolicy
+
   void MaterialDataManager::allocateArrayOfTangentOperatorBlocks() {
     if (this->thread_safe) {
       allocateArrayWithSynchronization(this->K, this->K_values,
@@ -139,11 +176,25 @@ namespace mgis::behaviour {
     this->speed_of_sound = m;
   }  // end of useExternalArrayOfSpeedOfSounds
 
+  void MaterialDataManager::allocateArrayOfIntegrationCosts() {
+    if (this->thread_safe) {
+      allocateArrayWithSynchronization(this->integration_costs,
+                                       this->integration_costs_values, this->n);
+    } else {
+      allocateArrayWithoutSynchronization(
+          this->integration_costs, this->integration_costs_values, this->n);
+    }
+  }  // end of allocateArrayOfIntegrationCosts
+
+  void MaterialDataManager::releaseArrayOfIntegrationCosts() {
+    this->integration_costs = mgis::span<real>();
+    this->integration_costs_values.clear();
+  }  // end of releaseArrayOfIntegrationCosts
+
   BehaviourIntegrationWorkSpace&
   MaterialDataManager::getBehaviourIntegrationWorkSpace() {
     if (this->thread_safe) {
-      static std::mutex mt;
-      std::lock_guard<std::mutex> lock(mt);
+      std::lock_guard<std::mutex> lock(this->iwks_mutex);
       const auto id = std::this_thread::get_id();
       auto p = this->iwks.find(id);
       if (p == this->iwks.end()) {
@@ -158,23 +209,116 @@ namespace mgis::behaviour {
     return *(this->iwk);
   }  // end of getBehaviourIntegrationWorkSpace
 
+  void MaterialDataManager::reserveBehaviourIntegrationWorkSpaces(
+      const size_type nth) {
+    if (this->worker_iwks.size() < nth) {
+      this->worker_iwks.resize(nth);
+    }
+  }  // end of reserveBehaviourIntegrationWorkSpaces
+
+  BehaviourIntegrationWorkSpace&
+  MaterialDataManager::getBehaviourIntegrationWorkSpace(const size_type i) {
+    if (i >= this->worker_iwks.size()) {
+      mgis::raise(
+          "MaterialDataManager::getBehaviourIntegrationWorkSpace: "
+          "invalid worker index");
+    }
+    auto& wk = this->worker_iwks[i];
+    if (wk == nullptr) {
+      wk = std::make_unique<BehaviourIntegrationWorkSpace>(b);
+    }
+    return *wk;
+  }  // end of getBehaviourIntegrationWorkSpace
+
   void MaterialDataManager::releaseBehaviourIntegrationWorkspaces() {
     this->iwk.reset();
     this->iwks.clear();
+    this->worker_iwks.clear();
   }  // end of releaseBehaviourIntegrationWorkspaces
 
+  std::shared_ptr<const GatherPlan> MaterialDataManager::getGatherPlan() {
+    auto update_gather_plan = [this] {
+      if ((this->gather_plan == nullptr) ||
+          (!isGatherPlanValid(*(this->gather_plan), *this))) {
+        this->gather_plan =
+            std::make_shared<const GatherPlan>(buildGatherPlan(*this));
+      }
+      return this->gather_plan;
+    };
+    if (this->thread_safe) {
+      std::lock_guard<std::mutex> lock(this->gather_plan_mutex);
+      return update_gather_plan();
+    }
+    return update_gather_plan();
+  }  // end of getGatherPlan
+
   MaterialDataManager::~MaterialDataManager() = default;
 
+  //! \return if the stiffness matrices must be reset by update and revert
+  static bool mustResetTangentOperator(const MaterialDataManager& m) {
+    using TangentOperatorResetPolicy =
+        MaterialDataManager::TangentOperatorResetPolicy;
+    return m.getTangentOperatorResetPolicy() ==
+           TangentOperatorResetPolicy::EAGER_RESET;
+  }  // end of mustResetTangentOperator
+
+  //! \brief fill the stiffness matrices with zero, if required
+  static void resetTangentOperator(MaterialDataManager& m) {
+    if (mustResetTangentOperator(m)) {
+      std::fill(m.K.begin(), m.K.end(), real{0});
+    }
+  }  // end of resetTangentOperator
+
   void update(MaterialDataManager& m) {
-    std::fill(m.K.begin(), m.K.end(), real{0});
-    updateValues(m.s0, m.s1);
+    resetTangentOperator(m);
+    using UpdatePolicy = MaterialDataManager::UpdatePolicy;
+    if (m.getUpdatePolicy() == UpdatePolicy::SWAP_BUFFERS) {
+      swapValues(m.s0, m.s1);
+    } else {
+      updateValues(m.s0, m.s1);
+    }
   }  // end of update
 
   void revert(MaterialDataManager& m) {
-    std::fill(m.K.begin(), m.K.end(), real{0});
+    resetTangentOperator(m);
     updateValues(m.s1, m.s0);
+  }  // end of revert
+
+  /*!
+   * \brief fill the stiffness matrices with zero, if required, distributing
+   * the integration points between the threads of a thread pool.
+   * \param[in,out] p: thread pool
+   * \param[in,out] m: material data manager
+   */
+  static void resetTangentOperator(mgis::ThreadPool& p,
+                                   MaterialDataManager& m) {
+    if ((!mustResetTangentOperator(m)) || (m.K.empty()) || (m.n == 0)) {
+      return;
+    }
+    const auto stride = static_cast<size_type>(m.K.size()) / m.n;
+    parallel_for(p, m.n,
+                 [&m, stride](const size_type, const size_type b,
+                              const size_type e) {
+                   std::fill(m.K.begin() + b * stride,
+                             m.K.begin() + e * stride, real{0});
+                 });
+  }  // end of resetTangentOperator
+
+  void update(mgis::ThreadPool& p, MaterialDataManager& m) {
+    resetTangentOperator(p, m);
+    using UpdatePolicy = MaterialDataManager::UpdatePolicy;
+    if (m.getUpdatePolicy() == UpdatePolicy::SWAP_BUFFERS) {
+      swapValues(p, m.s0, m.s1);
+    } else {
+      updateValues(p, m.s0, m.s1);
+    }
   }  // end of update
 
+  void revert(mgis::ThreadPool& p, MaterialDataManager& m) {
+    resetTangentOperator(p, m);
+    updateValues(p, m.s1, m.s0);
+  }  // end of revert
+
   std::vector<mgis::real> allocatePostProcessingVariables(
       const MaterialDataManager& m, const std::string_view n){
     const auto s = getPostProcessingVariablesArraySize(m.b, n);
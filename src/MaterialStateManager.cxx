@@ -13,12 +13,48 @@
  */
 
 #include <algorithm>
+#include <type_traits>
 #include "MGIS/Raise.hxx"
+#include "MGIS/ParallelFor.hxx"
 #include "MGIS/Behaviour/Behaviour.hxx"
 #include "MGIS/Behaviour/MaterialStateManager.hxx"
 
 namespace mgis::behaviour {
 
+  /*!
+   * \brief allocate an array storing `vs` values per integration point and
+   * set its values to zero.
+   *
+   * If a thread pool is given, the integration points are split as in the
+   * multi-threaded integration functions and the values associated with
+   * each block are set by one task of the pool (first-touch policy).
+   *
+   * \param[out] view: view to the array
+   * \param[out] values: array
+   * \param[in] n: number of integration points
+   * \param[in] vs: number of values per integration point
+   * \param[in] p: thread pool
+   */
+  template <typename ValueType>
+  static void allocateArray(mgis::span<ValueType>& view,
+                            MaterialStateManager::Array<ValueType>& values,
+                            const size_type n,
+                            const size_type vs,
+                            mgis::ThreadPool* const p) {
+    // values are left uninitialized by the allocator
+    values.resize(n * vs);
+    view = mgis::span<ValueType>(values);
+    auto* const v = values.data();
+    if ((p == nullptr) || (p->getNumberOfThreads() < 2)) {
+      std::fill(v, v + n * vs, ValueType{0});
+      return;
+    }
+    mgis::parallel_for(*p, n, [v, vs](const size_type, const size_type b,
+                                      const size_type e) {
+      std::fill(v + b * vs, v + e * vs, ValueType{0});
+    });
+  }  // end of allocateArray
+
   MaterialStateManager::MaterialStateManager(const Behaviour& behaviour,
                                              const size_type s)
       : gradients_stride(
@@ -28,12 +64,11 @@ namespace mgis::behaviour {
         internal_state_variables_stride(
             getArraySize(behaviour.isvs, behaviour.hypothesis)),
         n(s),
+        precision(StateStoragePrecision::DOUBLE_PRECISION),
         b(behaviour) {
     auto init = [this](mgis::span<mgis::real>& view,
-                       std::vector<mgis::real>& values, const size_type vs) {
-      constexpr const auto zero = real{0};
-      values.resize(this->n * vs, zero);
-      view = mgis::span<mgis::real>(values);
+                       Array<mgis::real>& values, const size_type vs) {
+      allocateArray(view, values, this->n, vs, nullptr);
     };
     init(this->gradients, this->gradients_values, this->gradients_stride);
     if ((this->b.btype == Behaviour::STANDARDFINITESTRAINBEHAVIOUR) &&
@@ -67,15 +102,14 @@ namespace mgis::behaviour {
         internal_state_variables_stride(
             getArraySize(behaviour.isvs, behaviour.hypothesis)),
         n(s),
+        precision(i.precision),
         b(behaviour) {
-    auto init = [this](mgis::span<mgis::real>& view,
-                       std::vector<mgis::real>& values,
-                       const mgis::span<mgis::real>& evalues,
-                       const size_type vs, const char* const vn) {
+    auto init = [this, &i](mgis::span<mgis::real>& view,
+                           Array<mgis::real>& values,
+                           const mgis::span<mgis::real>& evalues,
+                           const size_type vs, const char* const vn) {
       if (evalues.empty()) {
-        constexpr const auto zero = real{0};
-        values.resize(this->n * vs, zero);
-        view = mgis::span<mgis::real>(values);
+        allocateArray(view, values, this->n, vs, i.thread_pool);
       } else {
         if (static_cast<size_type>(evalues.size()) != this->n * vs) {
           mgis::raise(
@@ -86,23 +120,54 @@ namespace mgis::behaviour {
         view = evalues;
       }
     };
-    init(this->gradients, this->gradients_values, i.gradients,
-         this->gradients_stride, "gradients");
-    if ((this->b.btype == Behaviour::STANDARDFINITESTRAINBEHAVIOUR) &&
-        (this->b.kinematic == Behaviour::FINITESTRAINKINEMATIC_F_CAUCHY) &&
-        (i.gradients.empty())) {
-      for (size_type ig = 0; ig != this->n; ++ig) {
-        auto F = this->gradients.subspan(ig * gradients_stride,  //
-                                         gradients_stride);
-        F[0] = F[1] = F[2] = real{1};
+    if (this->precision == StateStoragePrecision::SINGLE_PRECISION) {
+      if ((!i.gradients.empty()) || (!i.thermodynamic_forces.empty()) ||
+          (!i.internal_state_variables.empty())) {
+        mgis::raise(
+            "MaterialStateManager::MaterialStateManager: "
+            "externally allocated memory for the gradients, the "
+            "thermodynamic forces or the internal state variables is not "
+            "supported in the single precision storage mode");
+      }
+      auto init_f = [this, &i](mgis::span<float>& view, Array<float>& values,
+                               const size_type vs) {
+        allocateArray(view, values, this->n, vs, i.thread_pool);
+      };
+      init_f(this->single_precision_gradients,
+             this->single_precision_gradients_values, this->gradients_stride);
+      if ((this->b.btype == Behaviour::STANDARDFINITESTRAINBEHAVIOUR) &&
+          (this->b.kinematic == Behaviour::FINITESTRAINKINEMATIC_F_CAUCHY)) {
+        for (size_type ig = 0; ig != this->n; ++ig) {
+          auto F = this->single_precision_gradients.subspan(
+              ig * gradients_stride, gradients_stride);
+          F[0] = F[1] = F[2] = float{1};
+        }
+      }
+      init_f(this->single_precision_thermodynamic_forces,
+             this->single_precision_thermodynamic_forces_values,
+             this->thermodynamic_forces_stride);
+      init_f(this->single_precision_internal_state_variables,
+             this->single_precision_internal_state_variables_values,
+             this->internal_state_variables_stride);
+    } else {
+      init(this->gradients, this->gradients_values, i.gradients,
+           this->gradients_stride, "gradients");
+      if ((this->b.btype == Behaviour::STANDARDFINITESTRAINBEHAVIOUR) &&
+          (this->b.kinematic == Behaviour::FINITESTRAINKINEMATIC_F_CAUCHY) &&
+          (i.gradients.empty())) {
+        for (size_type ig = 0; ig != this->n; ++ig) {
+          auto F = this->gradients.subspan(ig * gradients_stride,  //
+                                           gradients_stride);
+          F[0] = F[1] = F[2] = real{1};
+        }
       }
+      init(this->thermodynamic_forces, this->thermodynamic_forces_values,
+           i.thermodynamic_forces, this->thermodynamic_forces_stride,
+           "thermodynamic forces");
+      init(this->internal_state_variables,
+           this->internal_state_variables_values, i.internal_state_variables,
+           this->internal_state_variables_stride, "internal state variables");
     }
-    init(this->thermodynamic_forces, this->thermodynamic_forces_values,
-         i.thermodynamic_forces, this->thermodynamic_forces_stride,
-         "thermodynamic forces");
-    init(this->internal_state_variables, this->internal_state_variables_values,
-         i.internal_state_variables, this->internal_state_variables_stride,
-         "internal state variables");
     if (b.computesStoredEnergy) {
       init(this->stored_energies, this->stored_energies_values,
            i.stored_energies, 1u, "stored energies");
@@ -165,12 +230,13 @@ namespace mgis::behaviour {
   void setMaterialProperty(MaterialStateManager& m,
                            const mgis::string_view& n,
                            const real v) {
-    const auto mp = getVariable(m.b.mps, n);
+    const auto mp = getVariable(m.b.mps, m.b.mps_index, n);
     mgis::raise_if(mp.type != Variable::SCALAR,
                    "setMaterialProperty: "
                    "invalid material property "
                    "(only scalar material property is supported)");
     getFieldHolder(m.material_properties, n) = v;
+    ++(m.layout_version);
   }  // end of setMaterialProperty
 
   MGIS_EXPORT void setMaterialProperty(
@@ -178,7 +244,7 @@ namespace mgis::behaviour {
       const mgis::string_view& n,
       const mgis::span<real>& v,
       const MaterialStateManager::StorageMode s) {
-    const auto mp = getVariable(m.b.mps, n);
+    const auto mp = getVariable(m.b.mps, m.b.mps_index, n);
     mgis::raise_if(mp.type != Variable::SCALAR,
                    "setMaterialProperty: "
                    "invalid material property "
@@ -192,6 +258,7 @@ namespace mgis::behaviour {
     } else {
       getFieldHolder(m.material_properties, n) = v;
     }
+    ++(m.layout_version);
   }  // end of setMaterialProperty
 
   bool isMaterialPropertyDefined(const MaterialStateManager& m,
@@ -215,12 +282,13 @@ namespace mgis::behaviour {
   void setExternalStateVariable(MaterialStateManager& m,
                                 const mgis::string_view& n,
                                 const real v) {
-    const auto esv = getVariable(m.b.esvs, n);
+    const auto esv = getVariable(m.b.esvs, m.b.esvs_index, n);
     mgis::raise_if(esv.type != Variable::SCALAR,
                    "setExternalStateVariable: "
                    "invalid external state variable "
                    "(only scalar external state variable is supported)");
     getFieldHolder(m.external_state_variables, n) = v;
+    ++(m.layout_version);
   }  // end of setExternalStateVariable
 
   MGIS_EXPORT void setExternalStateVariable(
@@ -228,7 +296,7 @@ namespace mgis::behaviour {
       const mgis::string_view& n,
       const mgis::span<real>& v,
       const MaterialStateManager::StorageMode s) {
-    const auto esv = getVariable(m.b.esvs, n);
+    const auto esv = getVariable(m.b.esvs, m.b.esvs_index, n);
     const auto vs = getVariableSize(esv, m.b.hypothesis);
     mgis::raise_if(((static_cast<mgis::size_type>(v.size()) != m.n * vs) &&
                     (static_cast<mgis::size_type>(v.size()) != vs)),
@@ -243,6 +311,7 @@ namespace mgis::behaviour {
     } else {
       getFieldHolder(m.external_state_variables, n) = v;
     }
+    ++(m.layout_version);
   }  // end of setExternalStateVariable
 
   bool isExternalStateVariableDefined(const MaterialStateManager& m,
@@ -261,165 +330,438 @@ namespace mgis::behaviour {
     return std::holds_alternative<real>(p->second);
   }  // end of isExternalStateVariableUniform
 
-  void updateValues(MaterialStateManager& o, const MaterialStateManager& i) {
-    auto check_size = [](const mgis::size_type s1, const mgis::size_type s2) {
-      if (s1 != s2) {
+  static void checkArraysSizes(const mgis::size_type s1,
+                               const mgis::size_type s2) {
+    if (s1 != s2) {
+      mgis::raise(
+          "mgis::behaviour::updateValues: "
+          "arrays' size does not match");
+    }
+  }  // end of checkArraysSizes
+
+  static void updateFieldHolder(MaterialStateManager::FieldHolder& to,
+                                const MaterialStateManager::FieldHolder& from) {
+    if (std::holds_alternative<mgis::real>(from)) {
+      to = std::get<mgis::real>(from);
+    } else if (std::holds_alternative<std::vector<mgis::real>>(from)) {
+      const auto& from_v = std::get<std::vector<mgis::real>>(from);
+      if (std::holds_alternative<mgis::span<mgis::real>>(to)) {
+        // reuse existing memory
+        auto& to_v = std::get<mgis::span<mgis::real>>(to);
+        checkArraysSizes(from_v.size(), to_v.size());
+        std::copy(from_v.begin(), from_v.end(), to_v.begin());
+      } else if (std::holds_alternative<std::vector<mgis::real>>(to)) {
+        // reuse existing memory
+        auto& to_v = std::get<std::vector<mgis::real>>(to);
+        checkArraysSizes(from_v.size(), to_v.size());
+        std::copy(from_v.begin(), from_v.end(), to_v.begin());
+      } else {
+        // to contains a real value, so overwrite it with a new vector
+        to = std::get<std::vector<mgis::real>>(from);
+      }
+    } else {
+      const auto from_v = std::get<mgis::span<mgis::real>>(from);
+      if (std::holds_alternative<mgis::span<mgis::real>>(to)) {
+        // reuse existing memory
+        auto to_v = std::get<mgis::span<mgis::real>>(to);
+        checkArraysSizes(from_v.size(), to_v.size());
+        std::copy(from_v.begin(), from_v.end(), to_v.begin());
+      } else if (std::holds_alternative<std::vector<mgis::real>>(to)) {
+        // reuse existing memory
+        auto& to_v = std::get<std::vector<mgis::real>>(to);
+        checkArraysSizes(from_v.size(), to_v.size());
+        std::copy(from_v.begin(), from_v.end(), to_v.begin());
+      } else {
+        to = from_v;
+      }
+    }
+  }  // end of updateFieldHolder
+
+  /*!
+   * \brief update the given field holder by swapping the underlying values
+   * if both field holders store their values locally in arrays of the same
+   * size.
+   */
+  static void swapFieldHolder(MaterialStateManager::FieldHolder& to,
+                              MaterialStateManager::FieldHolder& from) {
+    if ((std::holds_alternative<std::vector<mgis::real>>(from)) &&
+        (std::holds_alternative<std::vector<mgis::real>>(to))) {
+      auto& from_v = std::get<std::vector<mgis::real>>(from);
+      auto& to_v = std::get<std::vector<mgis::real>>(to);
+      if (from_v.size() == to_v.size()) {
+        from_v.swap(to_v);
+        return;
+      }
+    }
+    updateFieldHolder(to, from);
+  }  // end of swapFieldHolder
+
+  static void checkMaterialProperties(
+      const Behaviour& b,
+      const std::map<std::string, MaterialStateManager::FieldHolder>& mps) {
+    for (const auto& mp : mps) {
+      if (!contains(b.mps, b.mps_index, mp.first)) {
         mgis::raise(
             "mgis::behaviour::updateValues: "
-            "arrays' size does not match");
+            "material property '" +
+            mp.first +
+            "' defined in the material state manager is not defined "
+            " by the behaviour");
       }
-    };  // end of check_size
-    auto update_span = [&check_size](mgis::span<real>& to,
-                                     const mgis::span<const real>& from) {
-      check_size(from.size(), to.size());
-      std::copy(from.begin(), from.end(), to.begin());
-    };  // end update_span
-    auto update_field_holder =
-        [&check_size](MaterialStateManager::FieldHolder& to,
-                      const MaterialStateManager::FieldHolder& from) {
-          if (std::holds_alternative<mgis::real>(from)) {
-            to = std::get<mgis::real>(from);
-          } else if (std::holds_alternative<std::vector<mgis::real>>(from)) {
-            const auto& from_v = std::get<std::vector<mgis::real>>(from);
-            if (std::holds_alternative<mgis::span<mgis::real>>(to)) {
-              // reuse existing memory
-              auto& to_v = std::get<mgis::span<mgis::real>>(to);
-              check_size(from_v.size(), to_v.size());
-              std::copy(from_v.begin(), from_v.end(), to_v.begin());
-            } else if (std::holds_alternative<std::vector<mgis::real>>(to)) {
-              // reuse existing memory
-              auto& to_v = std::get<std::vector<mgis::real>>(to);
-              check_size(from_v.size(), to_v.size());
-              std::copy(from_v.begin(), from_v.end(), to_v.begin());
-            } else {
-              // to contains a real value, so overwrite it with a new vector
-              to = std::get<std::vector<mgis::real>>(from);
-            }
-          } else {
-            const auto from_v = std::get<mgis::span<mgis::real>>(from);
-            if (std::holds_alternative<mgis::span<mgis::real>>(to)) {
-              // reuse existing memory
-              auto to_v = std::get<mgis::span<mgis::real>>(to);
-              check_size(from_v.size(), to_v.size());
-              std::copy(from_v.begin(), from_v.end(), to_v.begin());
-            } else if (std::holds_alternative<std::vector<mgis::real>>(to)) {
-              // reuse existing memory
-              auto to_v = std::get<std::vector<mgis::real>>(to);
-              check_size(from_v.size(), to_v.size());
-              std::copy(from_v.begin(), from_v.end(), to_v.begin());
-            } else {
-              to = from_v;
-            }
-          }
-        };  // end of update_field_holder
-    auto check_mps =
-        [](const Behaviour& b,
-           const std::map<std::string, MaterialStateManager::FieldHolder>&
-               mps) {
-          for (const auto& mp : mps) {
-            auto find_mp = [&mp](const Variable& d) {
-              return mp.first == d.name;
-            };
-            if (std::find_if(b.mps.begin(), b.mps.end(), find_mp) ==
-                b.mps.end()) {
-              mgis::raise(
-                  "mgis::behaviour::updateValues: "
-                  "material property '" +
-                  mp.first +
-                  "' defined in the material state manager is not defined "
-                  " by the behaviour");
-            }
-          }
-        };
+    }
+  }  // end of checkMaterialProperties
+
+  /*!
+   * \brief remove the field holders of `o` which are not defined in `i`.
+   * \return true if at least one field holder was removed.
+   */
+  static bool removeUndefinedFieldHolders(
+      std::map<std::string, MaterialStateManager::FieldHolder>& o,
+      const std::map<std::string, MaterialStateManager::FieldHolder>& i) {
+    auto removed = false;
+    auto p = o.begin();
+    while (p != o.end()) {
+      if (i.count(p->first) == 0) {
+        p = o.erase(p);
+        removed = true;
+      } else {
+        ++p;
+      }
+    }
+    return removed;
+  }  // end of removeUndefinedFieldHolders
+
+  /*!
+   * \brief update the field holders of `o` using the field holders of `i`.
+   * \return true if the layout of the field holders of `o` changed.
+   */
+  static bool updateFieldHolders(
+      std::map<std::string, MaterialStateManager::FieldHolder>& o,
+      const std::map<std::string, MaterialStateManager::FieldHolder>& i) {
+    auto changed = removeUndefinedFieldHolders(o, i);
+    for (const auto& v : i) {
+      const auto s = o.size();
+      auto& to = o[v.first];
+      const auto index = to.index();
+      updateFieldHolder(to, v.second);
+      changed = changed || (s != o.size()) || (index != to.index());
+    }
+    return changed;
+  }  // end of updateFieldHolders
+
+  static void checkUpdateValuesArguments(const MaterialStateManager& o,
+                                         const MaterialStateManager& i) {
     if (&i.b != &o.b) {
       mgis::raise(
           "mgis::behaviour::updateValues: the material state managers "
           "do not holds the same behaviour");
     }
-    check_mps(o.b, i.material_properties);
-    check_mps(o.b, o.material_properties);
-    update_span(o.gradients, i.gradients);
-    update_span(o.thermodynamic_forces, i.thermodynamic_forces);
-    update_span(o.internal_state_variables, i.internal_state_variables);
-    update_span(o.stored_energies, i.stored_energies);
-    update_span(o.dissipated_energies, i.dissipated_energies);
-    auto pmp = o.material_properties.begin();
-    while (pmp != o.material_properties.end()) {
-      if (i.material_properties.count(pmp->first) == 0) {
-        pmp = o.material_properties.erase(pmp);
-      } else {
-        ++pmp;
-      }
-    }
-    for (const auto& mp : i.material_properties) {
-      update_field_holder(o.material_properties[mp.first], mp.second);
+    if (i.precision != o.precision) {
+      mgis::raise(
+          "mgis::behaviour::updateValues: the material state managers "
+          "do not use the same storage precision");
     }
-    auto pev = o.external_state_variables.begin();
-    while (pev != o.external_state_variables.end()) {
-      if (i.external_state_variables.count(pev->first) == 0) {
-        pev = o.external_state_variables.erase(pev);
+    checkMaterialProperties(o.b, i.material_properties);
+    checkMaterialProperties(o.b, o.material_properties);
+  }  // end of checkUpdateValuesArguments
+
+  /*!
+   * \brief list of arrays to be copied. The copies are performed by blocks
+   * of integration points, so that they can be distributed between the
+   * threads of a thread pool.
+   */
+  struct ArraysCopies {
+    /*!
+     * \brief add a new copy
+     * \param[out] to: destination
+     * \param[in] from: source
+     */
+    template <typename ValueType>
+    void add(mgis::span<ValueType>& to, const mgis::span<ValueType>& from) {
+      checkArraysSizes(from.size(), to.size());
+      if (from.empty()) {
+        return;
+      }
+      if constexpr (std::is_same_v<ValueType, float>) {
+        this->single_precision_arrays.push_back({to.data(), from.data(),
+                                                 static_cast<size_type>(
+                                                     from.size())});
       } else {
-        ++pev;
+        this->arrays.push_back({to.data(), from.data(),
+                                static_cast<size_type>(from.size())});
       }
+    }  // end of add
+    /*!
+     * \brief perform the copies
+     * \param[in] n: number of integration points
+     * \param[in] loop: function distributing the integration points
+     */
+    template <typename Loop>
+    void execute(const size_type n, const Loop& loop) const {
+      if ((n == 0) ||
+          ((this->arrays.empty()) && (this->single_precision_arrays.empty()))) {
+        return;
+      }
+      loop([this, n](const size_type b, const size_type e) {
+        copy(this->arrays, n, b, e);
+        copy(this->single_precision_arrays, n, b, e);
+      });
+    }  // end of execute
+
+   private:
+    //! \brief description of the copy of an array
+    template <typename ValueType>
+    struct ArrayCopy {
+      //! \brief destination
+      ValueType* to;
+      //! \brief source
+      const ValueType* from;
+      //! \brief size of the array
+      size_type size;
+    };
+    /*!
+     * \brief copy the values associated with a block of integration points
+     * \param[in] copies: copies to be performed
+     * \param[in] n: number of integration points
+     * \param[in] b: first integration point of the block
+     * \param[in] e: integration point after the last integration point of
+     * the block
+     */
+    template <typename ValueType>
+    static void copy(const std::vector<ArrayCopy<ValueType>>& copies,
+                     const size_type n,
+                     const size_type b,
+                     const size_type e) {
+      for (const auto& c : copies) {
+        const auto stride = c.size / n;
+        std::copy(c.from + b * stride, c.from + e * stride, c.to + b * stride);
+      }
+    }  // end of copy
+    //! \brief copies of double precision arrays
+    std::vector<ArrayCopy<mgis::real>> arrays;
+    //! \brief copies of single precision arrays
+    std::vector<ArrayCopy<float>> single_precision_arrays;
+  };  // end of struct ArraysCopies
+
+  //! \brief sequential treatment of the integration points
+  static auto sequentialLoop(const MaterialStateManager& s) {
+    return [&s](const auto& f) { f(size_type{0}, s.n); };
+  }  // end of sequentialLoop
+
+  /*!
+   * \brief treatment of the integration points by the threads of a thread
+   * pool
+   */
+  static auto parallelLoop(mgis::ThreadPool& p, const MaterialStateManager& s) {
+    return [&p, &s](const auto& f) {
+      mgis::parallel_for(p, s.n,
+                         [&f](const size_type, const size_type b,
+                              const size_type e) { f(b, e); });
+    };
+  }  // end of parallelLoop
+
+  template <typename Loop>
+  static void updateValues(MaterialStateManager& o,
+                           const MaterialStateManager& i,
+                           const Loop& loop) {
+    checkUpdateValuesArguments(o, i);
+    auto copies = ArraysCopies{};
+    copies.add(o.gradients, i.gradients);
+    copies.add(o.thermodynamic_forces, i.thermodynamic_forces);
+    copies.add(o.internal_state_variables, i.internal_state_variables);
+    copies.add(o.single_precision_gradients, i.single_precision_gradients);
+    copies.add(o.single_precision_thermodynamic_forces,
+               i.single_precision_thermodynamic_forces);
+    copies.add(o.single_precision_internal_state_variables,
+               i.single_precision_internal_state_variables);
+    copies.add(o.stored_energies, i.stored_energies);
+    copies.add(o.dissipated_energies, i.dissipated_energies);
+    copies.execute(o.n, loop);
+    const auto mps_changed =
+        updateFieldHolders(o.material_properties, i.material_properties);
+    const auto esvs_changed = updateFieldHolders(o.external_state_variables,
+                                                 i.external_state_variables);
+    if ((mps_changed) || (esvs_changed)) {
+      ++(o.layout_version);
     }
-    for (const auto& ev : i.external_state_variables) {
-      update_field_holder(o.external_state_variables[ev.first], ev.second);
-    }
+  }  // end of updateValues
+
+  void updateValues(MaterialStateManager& o, const MaterialStateManager& i) {
+    updateValues(o, i, sequentialLoop(o));
+  }  // end of updateValues
+
+  void updateValues(mgis::ThreadPool& p,
+                    MaterialStateManager& o,
+                    const MaterialStateManager& i) {
+    updateValues(o, i, parallelLoop(p, o));
   }  // end of updateValues
 
   namespace internals {
 
-    void extractScalarInternalStateVariable(
-        mgis::span<mgis::real> o,
-        const mgis::behaviour::MaterialStateManager& s,
-        const mgis::size_type offset) {
-      const auto stride = s.internal_state_variables_stride;
-      auto* const p = o.data();
-      const auto* const piv = s.internal_state_variables.data() + offset;
-      for (mgis::size_type i = 0; i != s.n; ++i) {
-        p[i] = piv[i * stride];
-      }
-    }  // end of extractScalarInternalStateVariable
+    /*!
+     * \brief structure implementing the `swapValues` functions. This
+     * structure is a friend of the `MaterialStateManager` class.
+     */
+    struct SwapValuesImplementation {
+      template <typename Loop>
+      static void execute(MaterialStateManager& o,
+                          MaterialStateManager& i,
+                          const Loop& loop) {
+        auto copies = ArraysCopies{};
+        // swap the views and the values if both arrays are locally allocated,
+        // copy the values otherwise
+        auto swap_or_update = [&copies](auto& to, auto& to_v, auto& from,
+                                        auto& from_v) {
+          const auto is_local = [](const auto& view, const auto& values) {
+            return (!values.empty()) && (view.data() == values.data()) &&
+                   (static_cast<mgis::size_type>(view.size()) ==
+                    static_cast<mgis::size_type>(values.size()));
+          };
+          if ((is_local(to, to_v)) && (is_local(from, from_v))) {
+            checkArraysSizes(from.size(), to.size());
+            to_v.swap(from_v);
+            std::swap(to, from);
+          } else {
+            copies.add(to, from);
+          }
+        };
+        checkUpdateValuesArguments(o, i);
+        swap_or_update(o.gradients, o.gradients_values, i.gradients,
+                       i.gradients_values);
+        swap_or_update(o.thermodynamic_forces, o.thermodynamic_forces_values,
+                       i.thermodynamic_forces, i.thermodynamic_forces_values);
+        swap_or_update(o.internal_state_variables,
+                       o.internal_state_variables_values,
+                       i.internal_state_variables,
+                       i.internal_state_variables_values);
+        swap_or_update(o.single_precision_gradients,
+                       o.single_precision_gradients_values,
+                       i.single_precision_gradients,
+                       i.single_precision_gradients_values);
+        swap_or_update(o.single_precision_thermodynamic_forces,
+                       o.single_precision_thermodynamic_forces_values,
+                       i.single_precision_thermodynamic_forces,
+                       i.single_precision_thermodynamic_forces_values);
+        swap_or_update(o.single_precision_internal_state_variables,
+                       o.single_precision_internal_state_variables_values,
+                       i.single_precision_internal_state_variables,
+                       i.single_precision_internal_state_variables_values);
+        swap_or_update(o.stored_energies, o.stored_energies_values,
+                       i.stored_energies, i.stored_energies_values);
+        swap_or_update(o.dissipated_energies, o.dissipated_energies_values,
+                       i.dissipated_energies, i.dissipated_energies_values);
+        copies.execute(o.n, loop);
+        removeUndefinedFieldHolders(o.material_properties,
+                                    i.material_properties);
+        for (auto& mp : i.material_properties) {
+          swapFieldHolder(o.material_properties[mp.first], mp.second);
+        }
+        removeUndefinedFieldHolders(o.external_state_variables,
+                                    i.external_state_variables);
+        for (auto& ev : i.external_state_variables) {
+          swapFieldHolder(o.external_state_variables[ev.first], ev.second);
+        }
+        ++(o.layout_version);
+        ++(i.layout_version);
+      }  // end of execute
+    };  // end of struct SwapValuesImplementation
+
+  }  // end of namespace internals
 
-    void extractInternalStateVariable(
+  void swapValues(MaterialStateManager& o, MaterialStateManager& i) {
+    internals::SwapValuesImplementation::execute(o, i, sequentialLoop(o));
+  }  // end of swapValues
+
+  void swapValues(mgis::ThreadPool& p,
+                  MaterialStateManager& o,
+                  MaterialStateManager& i) {
+    internals::SwapValuesImplementation::execute(o, i, parallelLoop(p, o));
+  }  // end of swapValues
+
+  namespace internals {
+
+    /*!
+     * \brief extract the values of an internal state variable for a block of
+     * integration points
+     * \param[out] o: output buffer
+     * \param[in] s: material state manager
+     * \param[in] nc: number of components of the internal state variable
+     * \param[in] piv: pointer to the first component of the internal state
+     * variable for the first integration point
+     * \param[in] b: first integration point of the block
+     * \param[in] e: integration point after the last integration point of
+     * the block
+     */
+    template <typename ValueType>
+    static void extractInternalStateVariable(
         mgis::span<mgis::real> o,
         const mgis::behaviour::MaterialStateManager& s,
         const mgis::size_type nc,
-        const mgis::size_type offset) {
+        const ValueType* const piv,
+        const mgis::size_type b,
+        const mgis::size_type e) {
       const auto stride = s.internal_state_variables_stride;
-      auto* p = o.data();
-      const auto* const piv = s.internal_state_variables.data() + offset;
-      for (mgis::size_type i = 0; i != s.n; ++i) {
+      if (nc == 1) {
+        auto* const p = o.data();
+        for (mgis::size_type i = b; i != e; ++i) {
+          p[i] = static_cast<mgis::real>(piv[i * stride]);
+        }
+        return;
+      }
+      auto* p = o.data() + b * nc;
+      for (mgis::size_type i = b; i != e; ++i) {
         const auto is = i * stride;
         for (mgis::size_type j = 0; j != nc; ++j, ++p) {
-          *p = piv[is + j];
+          *p = static_cast<mgis::real>(piv[is + j]);
         }
       }
-    }  // end of extractScalarInternalStateVariable
+    }  // end of extractInternalStateVariable
 
   }  // end of namespace internals
 
-  void extractInternalStateVariable(
+  template <typename Loop>
+  static void extractInternalStateVariable(
       mgis::span<mgis::real> o,
       const mgis::behaviour::MaterialStateManager& s,
-      const mgis::string_view n) {
-    const auto& iv = mgis::behaviour::getVariable(s.b.isvs, n);
+      const mgis::string_view n,
+      const Loop& loop) {
+    const auto& iv = mgis::behaviour::getVariable(s.b.isvs, s.b.isvs_index, n);
     const auto nc = mgis::behaviour::getVariableSize(iv, s.b.hypothesis);
     const auto offset =
-        mgis::behaviour::getVariableOffset(s.b.isvs, n, s.b.hypothesis);
+        mgis::behaviour::getVariableOffset(s.b.isvs, s.b.isvs_index, n,
+                                           s.b.hypothesis);
     // checking compatibility
     if (o.size() != s.n * nc) {
       mgis::raise(
           "extractInternalStateVariable: "
           "unmatched number of integration points");
     }
-    if (nc == 1) {
-      mgis::behaviour::internals::extractScalarInternalStateVariable(o, s,
-                                                                     offset);
-    } else {
-      mgis::behaviour::internals::extractInternalStateVariable(o, s, nc,
-                                                               offset);
-    }
+    loop([&o, &s, nc, offset](const size_type b, const size_type e) {
+      if (s.precision == StateStoragePrecision::SINGLE_PRECISION) {
+        internals::extractInternalStateVariable(
+            o, s, nc,
+            s.single_precision_internal_state_variables.data() + offset, b,
+            e);
+      } else {
+        internals::extractInternalStateVariable(
+            o, s, nc, s.internal_state_variables.data() + offset, b, e);
+      }
+    });
+  }  // end of extractInternalStateVariable
+
+  void extractInternalStateVariable(
+      mgis::span<mgis::real> o,
+      const mgis::behaviour::MaterialStateManager& s,
+      const mgis::string_view n) {
+    extractInternalStateVariable(o, s, n, sequentialLoop(s));
+  }  // end of extractInternalStateVariable
+
+  void extractInternalStateVariable(
+      mgis::ThreadPool& p,
+      mgis::span<mgis::real> o,
+      const mgis::behaviour::MaterialStateManager& s,
+      const mgis::string_view n) {
+    extractInternalStateVariable(o, s, n, parallelLoop(p, s));
   }  // end of extractInternalStateVariable
 
 }  // end of namespace mgis::behaviour
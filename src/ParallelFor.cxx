@@ -0,0 +1,70 @@
+/*!
+ * \file   src/ParallelFor.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <algorithm>
+#include "MGIS/Raise.hxx"
+#include "MGIS/ParallelFor.hxx"
+
+namespace mgis::internals {
+
+  static std::vector<size_type> checkParallelForBlocks(
+      std::vector<size_type> b) {
+    if (b.size() < 2) {
+      mgis::raise("ParallelForState::ParallelForState: invalid partition");
+    }
+    if (!std::is_sorted(b.begin(), b.end())) {
+      mgis::raise(
+          "ParallelForState::ParallelForState: "
+          "the boundaries of the blocks are not sorted");
+    }
+    return b;
+  }  // end of checkParallelForBlocks
+
+  static size_type getParallelForGrainSize(const std::vector<size_type>& b,
+                                           const SchedulingOptions& s) {
+    if (s.policy != SchedulingPolicy::WORK_STEALING) {
+      return 0;
+    }
+    if (s.grain_size != 0) {
+      return s.grain_size;
+    }
+    const auto nb = static_cast<size_type>(b.size() - 1);
+    return std::max(size_type{1}, (b.back() - b.front()) / (16 * nb));
+  }  // end of getParallelForGrainSize
+
+  ParallelForState::ParallelForState(std::vector<size_type> b,
+                                     const SchedulingOptions& s)
+      : blocks(checkParallelForBlocks(std::move(b))),
+        grain_size(getParallelForGrainSize(blocks, s)),
+        next(blocks.size() - 1) {
+    for (size_type i = 0; i != this->next.size(); ++i) {
+      this->next[i].store(this->blocks[i]);
+    }
+  }  // end of ParallelForState
+
+  size_type ParallelForState::getNumberOfBlocks() const {
+    return static_cast<size_type>(this->blocks.size() - 1);
+  }  // end of getNumberOfBlocks
+
+  bool ParallelForState::claim(size_type& b, size_type& e, const size_type i) {
+    const auto be = this->blocks[i + 1];
+    b = this->next[i].fetch_add(this->grain_size, std::memory_order_relaxed);
+    if (b >= be) {
+      return false;
+    }
+    e = std::min(b + this->grain_size, be);
+    return true;
+  }  // end of claim
+
+}  // end of namespace mgis::internals
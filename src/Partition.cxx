@@ -0,0 +1,60 @@
+/*!
+ * \file   src/Partition.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <numeric>
+#include "MGIS/Raise.hxx"
+#include "MGIS/Partition.hxx"
+
+namespace mgis {
+
+  std::vector<size_type> getUniformPartition(const size_type n,
+                                             const size_type nth) {
+    if (nth == 0) {
+      mgis::raise("getUniformPartition: invalid number of blocks");
+    }
+    const auto d = n / nth;
+    const auto r = n % nth;
+    auto blocks = std::vector<size_type>(nth + 1, size_type{0});
+    for (size_type i = 0; i != nth; ++i) {
+      blocks[i + 1] = (i < r) ? blocks[i] + d + 1 : blocks[i] + d;
+    }
+    return blocks;
+  }  // end of getUniformPartition
+
+  std::vector<size_type> getCostBasedPartition(
+      mgis::span<const real> costs, const size_type nth) {
+    if (nth == 0) {
+      mgis::raise("getCostBasedPartition: invalid number of blocks");
+    }
+    const auto n = static_cast<size_type>(costs.size());
+    const auto total = std::accumulate(costs.begin(), costs.end(), real{0});
+    if (!(total > 0)) {
+      return getUniformPartition(n, nth);
+    }
+    auto blocks = std::vector<size_type>(nth + 1, size_type{0});
+    auto c = real{0};
+    auto i = size_type{0};
+    for (size_type k = 1; k != nth; ++k) {
+      const auto target = total * static_cast<real>(k) / nth;
+      while ((i != n) && (c + costs[i] / 2 < target)) {
+        c += costs[i];
+        ++i;
+      }
+      blocks[k] = i;
+    }
+    blocks[nth] = n;
+    return blocks;
+  }  // end of getCostBasedPartition
+
+}  // end of namespace mgis
@@ -0,0 +1,377 @@
+/*!
+ * \file   src/PersistentBehaviourCache.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <atomic>
+#include <limits>
+#include <cstdio>
+#include <istream>
+#include <ostream>
+#include <fstream>
+#include <sys/types.h>
+#include <sys/stat.h>
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+#include "MGIS/LibrariesManager.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/PersistentBehaviourCache.hxx"
+
+namespace mgis::behaviour {
+
+  //! \brief first line of the files of the persistent cache
+  static const char *const persistent_cache_magic = "mgis-behaviour-cache 1";
+  /*!
+   * \brief upper bounds of the sizes read from the files of the persistent
+   * cache. Those files may be corrupted or truncated and the sizes read are
+   * checked before allocating any memory.
+   */
+  static constexpr std::size_t persistent_cache_maximum_string_size = 1 << 20;
+  static constexpr std::size_t persistent_cache_maximum_number_of_items =
+      1 << 16;
+
+  static std::atomic<bool> &getPersistentBehaviourCacheFlag() {
+    static std::atomic<bool> b(false);
+    return b;
+  }  // end of getPersistentBehaviourCacheFlag
+
+  void usePersistentBehaviourCache(const bool b) {
+    getPersistentBehaviourCacheFlag() = b;
+  }  // end of usePersistentBehaviourCache
+
+  bool isPersistentBehaviourCacheUsed() {
+    return getPersistentBehaviourCacheFlag();
+  }  // end of isPersistentBehaviourCacheUsed
+
+  /*
+   * The description is stored as a sequence of white-space separated
+   * tokens. Strings are prefixed by their length, so that they may contain
+   * any character.
+   */
+
+  static void write(std::ostream &os, const std::string &s) {
+    os << s.size() << ' ' << s << '\n';
+  }  // end of write
+
+  static void write(std::ostream &os, const Variable &v) {
+    write(os, v.name);
+    os << static_cast<int>(v.type) << ' ' << v.type_identifier << '\n';
+  }  // end of write
+
+  static void write(std::ostream &os, const std::vector<Variable> &vars) {
+    os << vars.size() << '\n';
+    for (const auto &v : vars) {
+      write(os, v);
+    }
+  }  // end of write
+
+  static void write(std::ostream &os, const std::vector<std::string> &values) {
+    os << values.size() << '\n';
+    for (const auto &v : values) {
+      write(os, v);
+    }
+  }  // end of write
+
+  /*!
+   * \brief read a number of items
+   * \return false if the number could not be read or is too large
+   * \param[in] is: input stream
+   * \param[out] n: number of items
+   */
+  static bool readNumberOfItems(std::istream &is, std::size_t &n) {
+    return (is >> n) && (n <= persistent_cache_maximum_number_of_items);
+  }  // end of readNumberOfItems
+
+  static bool read(std::istream &is, std::string &s) {
+    auto n = std::string::size_type{};
+    if (!(is >> n)) {
+      return false;
+    }
+    if ((n > persistent_cache_maximum_string_size) || (is.get() != ' ')) {
+      return false;
+    }
+    s.resize(n);
+    if ((n != 0) && (!is.read(&s[0], static_cast<std::streamsize>(n)))) {
+      return false;
+    }
+    return true;
+  }  // end of read
+
+  static bool read(std::istream &is, Variable &v) {
+    auto type = int{};
+    if ((!read(is, v.name)) || (!(is >> type >> v.type_identifier))) {
+      return false;
+    }
+    v.type = static_cast<Variable::Type>(type);
+    return true;
+  }  // end of read
+
+  template <typename ValueType>
+  static bool read(std::istream &is, std::vector<ValueType> &values) {
+    auto n = std::size_t{};
+    if (!readNumberOfItems(is, n)) {
+      return false;
+    }
+    values.resize(n);
+    for (auto &v : values) {
+      if (!read(is, v)) {
+        return false;
+      }
+    }
+    return true;
+  }  // end of read
+
+  void writeBehaviourDescription(std::ostream &os,
+                                 const PersistentBehaviourCacheKey &k,
+                                 const Behaviour &d) {
+    os.precision(std::numeric_limits<mgis::real>::max_digits10);
+    os << persistent_cache_magic << '\n';
+    write(os, k.path);
+    os << k.modification_time << '\n';
+    write(os, k.tfel_version);
+    write(os, d.library);
+    write(os, d.behaviour);
+    write(os, toString(d.hypothesis));
+    write(os, d.function);
+    write(os, d.source);
+    write(os, d.tfel_version);
+    os << static_cast<int>(d.btype) << ' ' << static_cast<int>(d.kinematic)
+       << ' ' << static_cast<int>(d.symmetry) << ' ' << d.computesStoredEnergy
+       << ' ' << d.computesDissipatedEnergy << '\n';
+    os << d.options.size();
+    for (const auto &o : d.options) {
+      os << ' ' << o;
+    }
+    os << '\n';
+    write(os, d.gradients);
+    write(os, d.thermodynamic_forces);
+    write(os, d.mps);
+    write(os, d.isvs);
+    write(os, d.esvs);
+    os << d.to_blocks.size() << '\n';
+    for (const auto &b : d.to_blocks) {
+      write(os, b.first);
+      write(os, b.second);
+    }
+    write(os, d.params);
+    write(os, d.iparams);
+    write(os, d.usparams);
+    os << d.initialize_functions.size() << '\n';
+    for (const auto &[n, f] : d.initialize_functions) {
+      write(os, n);
+      write(os, f.inputs);
+    }
+    os << d.postprocessings.size() << '\n';
+    for (const auto &[n, p] : d.postprocessings) {
+      write(os, n);
+      write(os, p.outputs);
+    }
+  }  // end of writeBehaviourDescription
+
+  std::optional<Behaviour> readBehaviourDescription(
+      std::istream &is, const PersistentBehaviourCacheKey &k) {
+    auto magic = std::string{};
+    if ((!std::getline(is, magic)) || (magic != persistent_cache_magic)) {
+      return {};
+    }
+    auto path = std::string{};
+    auto mtime = static_cast<long long>(0);
+    auto tfel_version = std::string{};
+    if ((!read(is, path)) || (!(is >> mtime)) || (!read(is, tfel_version))) {
+      return {};
+    }
+    if ((path != k.path) || (mtime != k.modification_time) ||
+        (tfel_version != k.tfel_version)) {
+      return {};
+    }
+    auto d = Behaviour{};
+    auto h = std::string{};
+    if ((!read(is, d.library)) || (!read(is, d.behaviour)) ||
+        (!read(is, h)) || (!read(is, d.function)) || (!read(is, d.source)) ||
+        (!read(is, d.tfel_version))) {
+      return {};
+    }
+    auto btype = int{};
+    auto kinematic = int{};
+    auto symmetry = int{};
+    if (!(is >> btype >> kinematic >> symmetry >> d.computesStoredEnergy >>
+          d.computesDissipatedEnergy)) {
+      return {};
+    }
+    try {
+      d.hypothesis = fromString(h);
+    } catch (...) {
+      return {};
+    }
+    d.btype = static_cast<Behaviour::BehaviourType>(btype);
+    d.kinematic = static_cast<Behaviour::Kinematic>(kinematic);
+    d.symmetry = static_cast<Behaviour::Symmetry>(symmetry);
+    auto nopts = std::size_t{};
+    if (!readNumberOfItems(is, nopts)) {
+      return {};
+    }
+    d.options.resize(nopts);
+    for (auto &o : d.options) {
+      if (!(is >> o)) {
+        return {};
+      }
+    }
+    if ((!read(is, d.gradients)) || (!read(is, d.thermodynamic_forces)) ||
+        (!read(is, d.mps)) || (!read(is, d.isvs)) || (!read(is, d.esvs))) {
+      return {};
+    }
+    auto nblocks = std::size_t{};
+    if (!readNumberOfItems(is, nblocks)) {
+      return {};
+    }
+    d.to_blocks.resize(nblocks);
+    for (auto &b : d.to_blocks) {
+      if ((!read(is, b.first)) || (!read(is, b.second))) {
+        return {};
+      }
+    }
+    if ((!read(is, d.params)) || (!read(is, d.iparams)) ||
+        (!read(is, d.usparams))) {
+      return {};
+    }
+    auto nifcts = std::size_t{};
+    if (!readNumberOfItems(is, nifcts)) {
+      return {};
+    }
+    for (std::size_t i = 0; i != nifcts; ++i) {
+      auto n = std::string{};
+      auto f = BehaviourInitializeFunction{};
+      f.f = nullptr;
+      if ((!read(is, n)) || (!read(is, f.inputs))) {
+        return {};
+      }
+      d.initialize_functions.insert({n, f});
+    }
+    auto npfcts = std::size_t{};
+    if (!readNumberOfItems(is, npfcts)) {
+      return {};
+    }
+    for (std::size_t i = 0; i != npfcts; ++i) {
+      auto n = std::string{};
+      auto p = BehaviourPostProcessing{};
+      p.f = nullptr;
+      if ((!read(is, n)) || (!read(is, p.outputs))) {
+        return {};
+      }
+      d.postprocessings.insert({n, p});
+    }
+    return d;
+  }  // end of readBehaviourDescription
+
+}  // end of namespace mgis::behaviour
+
+namespace mgis::behaviour::internals {
+
+  /*!
+   * \return the path to the file of the persistent cache associated with the
+   * given behaviour.
+   * \param[in] k: key associated with the library
+   * \param[in] b: behaviour
+   * \param[in] h: modelling hypothesis
+   */
+  static std::string getPersistentBehaviourCacheFile(
+      const PersistentBehaviourCacheKey &k,
+      const std::string &b,
+      const Hypothesis h) {
+    return k.path + '.' + b + '.' + toString(h) + ".mgis";
+  }  // end of getPersistentBehaviourCacheFile
+
+  std::optional<PersistentBehaviourCacheKey> getPersistentBehaviourCacheKey(
+      const std::string &l, const std::string &b) {
+    auto &lm = mgis::LibrariesManager::get();
+    auto k = PersistentBehaviourCacheKey{};
+    k.path = lm.getLibraryPath(l, b);
+    if (k.path.empty()) {
+      return {};
+    }
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+    struct _stat64 s;
+    if (::_stat64(k.path.c_str(), &s) != 0) {
+      return {};
+    }
+#else
+    struct stat s;
+    if (::stat(k.path.c_str(), &s) != 0) {
+      return {};
+    }
+#endif
+    k.modification_time = static_cast<long long>(s.st_mtime);
+    k.tfel_version = lm.getTFELVersion(l, b);
+    return k;
+  }  // end of getPersistentBehaviourCacheKey
+
+  std::optional<Behaviour> readPersistentBehaviourCache(
+      const PersistentBehaviourCacheKey &k,
+      const std::string &b,
+      const Hypothesis h) {
+    std::ifstream f(getPersistentBehaviourCacheFile(k, b, h),
+                    std::ios::binary);
+    if (!f) {
+      return {};
+    }
+    auto d = std::optional<Behaviour>{};
+    try {
+      d = readBehaviourDescription(f, k);
+    } catch (...) {
+      // a corrupted file is treated as a cache miss
+      return {};
+    }
+    if ((!d) || (d->behaviour != b) || (d->hypothesis != h)) {
+      return {};
+    }
+    return d;
+  }  // end of readPersistentBehaviourCache
+
+  void writePersistentBehaviourCache(const PersistentBehaviourCacheKey &k,
+                                     const Behaviour &d) {
+    const auto file = getPersistentBehaviourCacheFile(k, d.behaviour,  //
+                                                      d.hypothesis);
+    // the temporary file is unique to this process and this call, so that
+    // concurrent writers never share it
+    static std::atomic<unsigned long> counter(0);
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+    const auto pid = ::_getpid();
+#else
+    const auto pid = ::getpid();
+#endif
+    const auto tmp = file + '.' + std::to_string(pid) + '.' +
+                     std::to_string(counter++) + ".tmp";
+    {
+      std::ofstream f(tmp, std::ios::binary);
+      if (!f) {
+        return;
+      }
+      writeBehaviourDescription(f, k, d);
+      f.close();
+      if (!f) {
+        std::remove(tmp.c_str());
+        return;
+      }
+    }
+#if (defined _WIN32 || defined _WIN64) && (!defined __CYGWIN__)
+    // std::rename does not overwrite existing files on Windows
+    std::remove(file.c_str());
+#endif
+    if (std::rename(tmp.c_str(), file.c_str()) != 0) {
+      std::remove(tmp.c_str());
+    }
+  }  // end of writePersistentBehaviourCache
+
+}  // end of namespace mgis::behaviour::internals
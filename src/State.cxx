@@ -77,8 +77,9 @@ namespace mgis::behaviour {
   }  // end of State::State
 
   void setGradient(State& s, const string_view n, const real v) {
-    const auto& iv = getVariable(s.b.gradients, n);
-    const auto o = getVariableOffset(s.b.gradients, n, s.b.hypothesis);
+    const auto& iv = getVariable(s.b.gradients, s.b.gradients_index, n);
+    const auto o = getVariableOffset(s.b.gradients, s.b.gradients_index, n,
+                                     s.b.hypothesis);
     if (iv.type == Variable::SCALAR) {
       setGradient(s, o, v);
     } else {
@@ -88,8 +89,9 @@ namespace mgis::behaviour {
   }  // end of setGradient
 
   void setGradient(State& s, const string_view n, const real* const v) {
-    const auto& iv = getVariable(s.b.gradients, n);
-    const auto o = getVariableOffset(s.b.gradients, n, s.b.hypothesis);
+    const auto& iv = getVariable(s.b.gradients, s.b.gradients_index, n);
+    const auto o = getVariableOffset(s.b.gradients, s.b.gradients_index, n,
+                                     s.b.hypothesis);
     if (iv.type == Variable::SCALAR) {
       setGradient(s, o, *v);
     } else {
@@ -119,12 +121,14 @@ namespace mgis::behaviour {
   }  // end of setGradient
 
   real* getGradient(State& s, const string_view n) {
-    const auto o = getVariableOffset(s.b.gradients, n, s.b.hypothesis);
+    const auto o = getVariableOffset(s.b.gradients, s.b.gradients_index, n,
+                                     s.b.hypothesis);
     return getGradient(s, o);
   }  // end of getGradient
 
   const real* getGradient(const State& s, const string_view n) {
-    const auto o = getVariableOffset(s.b.gradients, n, s.b.hypothesis);
+    const auto o = getVariableOffset(s.b.gradients, s.b.gradients_index, n,
+                                     s.b.hypothesis);
     return getGradient(s, o);
   }  // end of getGradient
 
@@ -137,9 +141,11 @@ namespace mgis::behaviour {
   }  // end of getGradient
 
   void setThermodynamicForce(State& s, const string_view n, const real v) {
-    const auto& iv = getVariable(s.b.thermodynamic_forces, n);
+    const auto& iv = getVariable(s.b.thermodynamic_forces,
+                                 s.b.thermodynamic_forces_index, n);
     const auto o =
-        getVariableOffset(s.b.thermodynamic_forces, n, s.b.hypothesis);
+        getVariableOffset(s.b.thermodynamic_forces,
+                          s.b.thermodynamic_forces_index, n, s.b.hypothesis);
     if (iv.type == Variable::SCALAR) {
       setThermodynamicForce(s, o, v);
     } else {
@@ -151,9 +157,11 @@ namespace mgis::behaviour {
   void setThermodynamicForce(State& s,
                              const string_view n,
                              const real* const v) {
-    const auto& iv = getVariable(s.b.thermodynamic_forces, n);
+    const auto& iv = getVariable(s.b.thermodynamic_forces,
+                                 s.b.thermodynamic_forces_index, n);
     const auto o =
-        getVariableOffset(s.b.thermodynamic_forces, n, s.b.hypothesis);
+        getVariableOffset(s.b.thermodynamic_forces,
+                          s.b.thermodynamic_forces_index, n, s.b.hypothesis);
     if (iv.type == Variable::SCALAR) {
       setThermodynamicForce(s, o, *v);
     } else {
@@ -184,13 +192,15 @@ namespace mgis::behaviour {
 
   real* getThermodynamicForce(State& s, const string_view n) {
     const auto o =
-        getVariableOffset(s.b.thermodynamic_forces, n, s.b.hypothesis);
+        getVariableOffset(s.b.thermodynamic_forces,
+                          s.b.thermodynamic_forces_index, n, s.b.hypothesis);
     return getThermodynamicForce(s, o);
   }  // end of getThermodynamicForce
 
   const real* getThermodynamicForce(const State& s, const string_view n) {
     const auto o =
-        getVariableOffset(s.b.thermodynamic_forces, n, s.b.hypothesis);
+        getVariableOffset(s.b.thermodynamic_forces,
+                          s.b.thermodynamic_forces_index, n, s.b.hypothesis);
     return getThermodynamicForce(s, o);
   }  // end of getThermodynamicForce
 
@@ -203,17 +213,17 @@ namespace mgis::behaviour {
   }  // end of getThermodynamicForce
 
   void setMaterialProperty(State& s, const string_view n, const real v) {
-    const auto o = getVariableOffset(s.b.mps, n, s.b.hypothesis);
+    const auto o = getVariableOffset(s.b.mps, s.b.mps_index, n, s.b.hypothesis);
     setMaterialProperty(s, o, v);
   }  // end of setMaterialProperty
 
   real* getMaterialProperty(State& s, const string_view n) {
-    const auto o = getVariableOffset(s.b.mps, n, s.b.hypothesis);
+    const auto o = getVariableOffset(s.b.mps, s.b.mps_index, n, s.b.hypothesis);
     return getMaterialProperty(s, o);
   }  // end of getMaterialProperty
 
   const real* getMaterialProperty(const State& s, const string_view n) {
-    const auto o = getVariableOffset(s.b.mps, n, s.b.hypothesis);
+    const auto o = getVariableOffset(s.b.mps, s.b.mps_index, n, s.b.hypothesis);
     return getMaterialProperty(s, o);
   }  // end of getMaterialProperty
 
@@ -230,8 +240,9 @@ namespace mgis::behaviour {
   }  // end of getMaterialProperty
 
   void setInternalStateVariable(State& s, const string_view n, const real v) {
-    const auto& iv = getVariable(s.b.isvs, n);
-    const auto o = getVariableOffset(s.b.isvs, n, s.b.hypothesis);
+    const auto& iv = getVariable(s.b.isvs, s.b.isvs_index, n);
+    const auto o = getVariableOffset(s.b.isvs, s.b.isvs_index, n,
+                                     s.b.hypothesis);
     if (iv.type == Variable::SCALAR) {
       setInternalStateVariable(s, o, v);
     } else {
@@ -243,8 +254,9 @@ namespace mgis::behaviour {
   void setInternalStateVariable(State& s,
                                 const string_view n,
                                 const real* const v) {
-    const auto& iv = getVariable(s.b.isvs, n);
-    const auto o = getVariableOffset(s.b.isvs, n, s.b.hypothesis);
+    const auto& iv = getVariable(s.b.isvs, s.b.isvs_index, n);
+    const auto o = getVariableOffset(s.b.isvs, s.b.isvs_index, n,
+                                     s.b.hypothesis);
     if (iv.type == Variable::SCALAR) {
       setInternalStateVariable(s, o, *v);
     } else {
@@ -274,12 +286,14 @@ namespace mgis::behaviour {
   }  // end of setInternalStateVariable
 
   real* getInternalStateVariable(State& s, const string_view n) {
-    const auto o = getVariableOffset(s.b.isvs, n, s.b.hypothesis);
+    const auto o = getVariableOffset(s.b.isvs, s.b.isvs_index, n,
+                                     s.b.hypothesis);
     return getInternalStateVariable(s, o);
   }  // end of getInternalStateVariable
 
   const real* getInternalStateVariable(const State& s, const string_view n) {
-    const auto o = getVariableOffset(s.b.isvs, n, s.b.hypothesis);
+    const auto o = getVariableOffset(s.b.isvs, s.b.isvs_index, n,
+                                     s.b.hypothesis);
     return getInternalStateVariable(s, o);
   }  // end of getInternalStateVariable
 
@@ -292,19 +306,20 @@ namespace mgis::behaviour {
   }  // end of getInternalStateVariable
 
   void setExternalStateVariable(State& s, const string_view n, const real v) {
-    const auto& ev = getVariable(s.b.esvs, n);
+    const auto& ev = getVariable(s.b.esvs, s.b.esvs_index, n);
     if (ev.type != Variable::SCALAR) {
       mgis::raise("setExternalStateVariable: external state variable '" +
                   std::string{n} + "' is not a scalar");
     }
-    const auto o = getVariableOffset(s.b.esvs, n, s.b.hypothesis);
+    const auto o = getVariableOffset(s.b.esvs, s.b.esvs_index, n,
+                                     s.b.hypothesis);
     setExternalStateVariable(s, o, v);
   }  // end of setExternalStateVariable
 
   void setExternalStateVariable(State& s,
                                 const string_view n,
                                 const mgis::span<const real> v) {
-    const auto& ev = getVariable(s.b.esvs, n);
+    const auto& ev = getVariable(s.b.esvs, s.b.esvs_index, n);
     const auto es = getVariableSize(ev, s.b.hypothesis);
     if (v.size() != es) {
       mgis::raise(
@@ -316,7 +331,8 @@ namespace mgis::behaviour {
           std::to_string(v.size()) + " given, " + std::to_string(es) +
           "expected)");
     }
-    const auto o = getVariableOffset(s.b.esvs, n, s.b.hypothesis);
+    const auto o = getVariableOffset(s.b.esvs, s.b.esvs_index, n,
+                                     s.b.hypothesis);
     setExternalStateVariable(s, o, v);
   }  // end of setExternalStateVariable
 
@@ -331,12 +347,14 @@ namespace mgis::behaviour {
   }  // end of setExternalStateVariable
 
   real* getExternalStateVariable(State& s, const string_view n) {
-    const auto o = getVariableOffset(s.b.esvs, n, s.b.hypothesis);
+    const auto o = getVariableOffset(s.b.esvs, s.b.esvs_index, n,
+                                     s.b.hypothesis);
     return getExternalStateVariable(s, o);
   }  // end of getExternalStateVariable
 
   const real* getExternalStateVariable(const State& s, const string_view n) {
-    const auto o = getVariableOffset(s.b.esvs, n, s.b.hypothesis);
+    const auto o = getVariableOffset(s.b.esvs, s.b.esvs_index, n,
+                                     s.b.hypothesis);
     return getExternalStateVariable(s, o);
   }  // end of getExternalStateVariable
 
@@ -0,0 +1,186 @@
+/*!
+ * \file   src/TangentOperatorStorage.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <algorithm>
+#include "MGIS/Raise.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/TangentOperatorStorage.hxx"
+
+namespace mgis::behaviour {
+
+  mgis::size_type getPackedTangentOperatorArraySize(const Behaviour& b) {
+    auto s = mgis::size_type{};
+    for (const auto& block : b.to_blocks) {
+      const auto nr = getVariableSize(block.first, b.hypothesis);
+      const auto nc = getVariableSize(block.second, b.hypothesis);
+      if (nr != nc) {
+        mgis::raise(
+            "getPackedTangentOperatorArraySize: "
+            "tangent operator block associated with the derivative of '" +
+            block.first.name + "' with respect to '" + block.second.name +
+            "' is not square");
+      }
+      s += (nr * (nr + 1)) / 2;
+    }
+    return s;
+  }  // end of getPackedTangentOperatorArraySize
+
+  mgis::size_type getTangentOperatorArraySize(const Behaviour& b,
+                                              const TangentOperatorStorage s) {
+    if (s == TangentOperatorStorage::PACKED_SYMMETRIC_BLOCKS) {
+      return getPackedTangentOperatorArraySize(b);
+    }
+    return getTangentOperatorArraySize(b);
+  }  // end of getTangentOperatorArraySize
+
+  void packTangentOperatorBlocks(real* const Kp,
+                                 const real* const K,
+                                 const Behaviour& b) {
+    auto* p = Kp;
+    const auto* Kb = K;
+    for (const auto& block : b.to_blocks) {
+      const auto n = getVariableSize(block.first, b.hypothesis);
+      for (size_type r = 0; r != n; ++r) {
+        *p = Kb[r * n + r];
+        ++p;
+        for (size_type c = r + 1; c != n; ++c) {
+          *p = (Kb[r * n + c] + Kb[c * n + r]) / 2;
+          ++p;
+        }
+      }
+      Kb += n * n;
+    }
+  }  // end of packTangentOperatorBlocks
+
+  void unpackTangentOperatorBlocks(real* const K,
+                                   const real* const Kp,
+                                   const Behaviour& b) {
+    const auto* p = Kp;
+    auto* Kb = K;
+    for (const auto& block : b.to_blocks) {
+      const auto n = getVariableSize(block.first, b.hypothesis);
+      for (size_type r = 0; r != n; ++r) {
+        for (size_type c = r; c != n; ++c) {
+          Kb[r * n + c] = Kb[c * n + r] = *p;
+          ++p;
+        }
+      }
+      Kb += n * n;
+    }
+  }  // end of unpackTangentOperatorBlocks
+
+  static void checkTangentOperatorBlocks(const char* const f,
+                                         const MaterialDataManager& m) {
+    if (m.K.size() != m.n * m.K_stride) {
+      mgis::raise(std::string(f) +
+                  ": the tangent operator blocks have not been allocated");
+    }
+  }  // end of checkTangentOperatorBlocks
+
+  void unpackTangentOperatorBlocks(mgis::span<real> K,
+                                   const MaterialDataManager& m,
+                                   const mgis::size_type i) {
+    checkTangentOperatorBlocks("unpackTangentOperatorBlocks", m);
+    const auto s = getTangentOperatorArraySize(m.b);
+    if (K.size() != s) {
+      mgis::raise("unpackTangentOperatorBlocks: invalid array size");
+    }
+    if (i >= m.n) {
+      mgis::raise("unpackTangentOperatorBlocks: invalid integration point");
+    }
+    const auto* const Ki = m.K.data() + m.K_stride * i;
+    if (m.tangent_operator_storage ==
+        TangentOperatorStorage::PACKED_SYMMETRIC_BLOCKS) {
+      unpackTangentOperatorBlocks(K.data(), Ki, m.b);
+    } else {
+      std::copy(Ki, Ki + s, K.data());
+    }
+  }  // end of unpackTangentOperatorBlocks
+
+  void unpackTangentOperatorBlocks(mgis::span<real> K,
+                                   const MaterialDataManager& m) {
+    checkTangentOperatorBlocks("unpackTangentOperatorBlocks", m);
+    const auto s = getTangentOperatorArraySize(m.b);
+    if (K.size() != s * m.n) {
+      mgis::raise("unpackTangentOperatorBlocks: invalid array size");
+    }
+    if (m.tangent_operator_storage ==
+        TangentOperatorStorage::PACKED_SYMMETRIC_BLOCKS) {
+      for (size_type i = 0; i != m.n; ++i) {
+        unpackTangentOperatorBlocks(K.data() + s * i,
+                                    m.K.data() + m.K_stride * i, m.b);
+      }
+    } else {
+      std::copy(m.K.begin(), m.K.end(), K.begin());
+    }
+  }  // end of unpackTangentOperatorBlocks
+
+  void multiplyByTangentOperator(mgis::span<real> dt,
+                                 const MaterialDataManager& m,
+                                 const mgis::size_type i,
+                                 mgis::span<const real> dg) {
+    checkTangentOperatorBlocks("multiplyByTangentOperator", m);
+    const auto& b = m.b;
+    if ((dt.size() != m.s1.thermodynamic_forces_stride) ||
+        (dg.size() != m.s1.gradients_stride)) {
+      mgis::raise("multiplyByTangentOperator: invalid array size");
+    }
+    if (i >= m.n) {
+      mgis::raise("multiplyByTangentOperator: invalid integration point");
+    }
+    const auto packed = m.tangent_operator_storage ==
+                        TangentOperatorStorage::PACKED_SYMMETRIC_BLOCKS;
+    std::fill(dt.begin(), dt.end(), real{0});
+    const auto* Kb = m.K.data() + m.K_stride * i;
+    for (const auto& block : b.to_blocks) {
+      const auto nr = getVariableSize(block.first, b.hypothesis);
+      const auto nc = getVariableSize(block.second, b.hypothesis);
+      const auto bsize = packed ? (nr * (nr + 1)) / 2 : nr * nc;
+      if ((!contains(b.thermodynamic_forces, b.thermodynamic_forces_index,
+                     block.first.name)) ||
+          (!contains(b.gradients, b.gradients_index, block.second.name))) {
+        Kb += bsize;
+        continue;
+      }
+      auto* const y =
+          dt.data() + getVariableOffset(b.thermodynamic_forces,
+                                        b.thermodynamic_forces_index,
+                                        block.first.name, b.hypothesis);
+      const auto* const x =
+          dg.data() + getVariableOffset(b.gradients, b.gradients_index,
+                                        block.second.name, b.hypothesis);
+      if (packed) {
+        const auto* p = Kb;
+        for (size_type r = 0; r != nr; ++r) {
+          y[r] += (*p) * x[r];
+          ++p;
+          for (size_type c = r + 1; c != nr; ++c) {
+            y[r] += (*p) * x[c];
+            y[c] += (*p) * x[r];
+            ++p;
+          }
+        }
+      } else {
+        for (size_type r = 0; r != nr; ++r) {
+          for (size_type c = 0; c != nc; ++c) {
+            y[r] += Kb[r * nc + c] * x[c];
+          }
+        }
+      }
+      Kb += bsize;
+    }
+  }  // end of multiplyByTangentOperator
+
+}  // end of namespace mgis::behaviour
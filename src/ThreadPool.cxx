@@ -14,70 +14,240 @@
 
 #include <memory>
 #include <stdexcept>
+#include "MGIS/Raise.hxx"
+#include "MGIS/Topology.hxx"
 #include "MGIS/ThreadPool.hxx"
 
 namespace mgis {
 
-  ThreadPool::ThreadPool(const size_t n) {
-    this->statuses.resize(n, ThreadPool::Status::IDLE);
-    for (size_t i = 0; i < n; ++i) {
-      auto f = [this, i] {
-        for (;;) {
-          std::function<void()> task;
-          {
-            std::unique_lock<std::mutex> lock(this->m);
-            while (!(this->stop || !this->tasks.empty())) {
-              this->c.wait(
-                  lock, [this] { return this->stop || !this->tasks.empty(); });
-            }
-            if (this->stop && this->tasks.empty()) {
-              return;
-            }
-            task = std::move(this->tasks.front());
-            this->tasks.pop();
-            this->statuses[i] = ThreadPool::Status::WORKING;
-            this->c.notify_all();
-          }
-          task();
-          {
-            std::unique_lock<std::mutex> lock(this->m);
-            this->statuses[i] = ThreadPool::Status::IDLE;
-            this->c.notify_all();
-          }
-        }
-      };
-      this->workers.emplace_back(f);
+  //! \brief thread pool managing the current thread, if any
+  static thread_local const ThreadPool* current_thread_pool = nullptr;
+  //! \brief index of the current thread in the pool managing it
+  static thread_local size_type current_worker_index = 0;
+
+  ThreadPool::ThreadPool(const size_type n)
+      : ThreadPool(n, ThreadPoolOptions{}) {}  // end of ThreadPool::ThreadPool
+
+  ThreadPool::ThreadPool(const size_type n, const ThreadPoolOptions& o)
+      : workers_cpus(n), workers_numa_nodes(n) {
+    // processors to which the threads are bound
+    auto cpus = std::vector<size_type>{};
+    if (o.affinity == ThreadAffinityPolicy::ROUND_ROBIN) {
+      cpus = getAvailableCPUs();
+    } else if (o.affinity == ThreadAffinityPolicy::CPU_LIST) {
+      if (o.cpus.empty()) {
+        mgis::raise("ThreadPool::ThreadPool: empty list of processors");
+      }
+      cpus = o.cpus;
     }
-  }
+    this->queues.reserve(n);
+    for (size_type i = 0; i != n; ++i) {
+      this->queues.push_back(std::make_unique<TaskQueue>());
+    }
+    for (size_type i = 0; i != n; ++i) {
+      this->workers.emplace_back([this, i] { this->run(i); });
+    }
+    if (cpus.empty()) {
+      return;
+    }
+    try {
+      for (size_type i = 0; i != n; ++i) {
+        const auto cpu = cpus[i % cpus.size()];
+        bindThreadToCPU(this->workers[i], cpu);
+        this->workers_cpus[i] = cpu;
+        this->workers_numa_nodes[i] = getNUMANode(cpu);
+      }
+    } catch (...) {
+      // the destructor is not called if the constructor throws
+      this->stopWorkers();
+      throw;
+    }
+  }  // end of ThreadPool::ThreadPool
 
   size_type ThreadPool::getNumberOfThreads() const {
     return this->workers.size();
   }  // end of ThreadPool::getNumberOfThreads
 
-  void ThreadPool::wait() {
-    std::unique_lock<std::mutex> lock(this->m);
-    while (!this->tasks.empty()) {
-      this->c.wait(lock, [this] { return this->tasks.empty(); });
-    }
-    for (decltype(this->statuses.size()) i = 0; i != this->statuses.size();
-         ++i) {
-      while (this->statuses[i] != Status::IDLE) {
-        this->c.wait(lock,
-                     [this, i] { return this->statuses[i] == Status::IDLE; });
+  std::optional<size_type> ThreadPool::getCurrentWorkerIndex() const {
+    if (current_thread_pool != this) {
+      return {};
+    }
+    return current_worker_index;
+  }  // end of ThreadPool::getCurrentWorkerIndex
+
+  std::optional<size_type> ThreadPool::getWorkerCPU(const size_type i) const {
+    if (i >= this->workers_cpus.size()) {
+      mgis::raise("ThreadPool::getWorkerCPU: invalid worker index");
+    }
+    return this->workers_cpus[i];
+  }  // end of ThreadPool::getWorkerCPU
+
+  std::optional<size_type> ThreadPool::getWorkerNUMANode(
+      const size_type i) const {
+    if (i >= this->workers_numa_nodes.size()) {
+      mgis::raise("ThreadPool::getWorkerNUMANode: invalid worker index");
+    }
+    return this->workers_numa_nodes[i];
+  }  // end of ThreadPool::getWorkerNUMANode
+
+  std::optional<size_type> ThreadPool::getCurrentWorkerNUMANode() const {
+    if (current_thread_pool != this) {
+      return {};
+    }
+    return this->workers_numa_nodes[current_worker_index];
+  }  // end of ThreadPool::getCurrentWorkerNUMANode
+
+  ThreadPool::Task::~Task() = default;
+
+  void ThreadPool::run(const size_type i) {
+    current_thread_pool = this;
+    current_worker_index = i;
+    for (;;) {
+      auto t = this->pop(i);
+      if (t) {
+        t->execute();
+        t.reset();
+        if (this->number_of_unfinished_tasks.fetch_sub(1) == 1) {
+          // the lock guarantees that the notification is not lost by a
+          // thread entering the wait method
+          std::lock_guard<std::mutex> lock(this->m);
+          this->finished.notify_all();
+        }
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(this->m);
+      ++(this->number_of_idle_workers);
+      this->c.wait(lock, [this, i] { return this->stop || this->hasTask(i); });
+      --(this->number_of_idle_workers);
+      if (this->stop && (!this->hasTask(i))) {
+        return;
+      }
+    }
+  }  // end of ThreadPool::run
+
+  void ThreadPool::push(std::unique_ptr<Task> t) {
+    const auto n = this->queues.size();
+    if (n == 0) {
+      mgis::raise("ThreadPool::addTask: no thread in the pool");
+    }
+    // threads of the pool push their tasks in their own queue
+    const auto i = (current_thread_pool == this)
+                       ? current_worker_index
+                       : this->next_queue.fetch_add(1) % n;
+    {
+      auto& q = *(this->queues[i]);
+      std::lock_guard<std::mutex> lock(q.m);
+      // don't allow enqueueing after stopping the pool
+      if (this->stop) {
+        mgis::raise(
+            "ThreadPool::addTask: "
+            "enqueue on stopped ThreadPool");
+      }
+      q.tasks.push_back(std::move(t));
+      ++(this->number_of_unfinished_tasks);
+      ++(this->number_of_queued_tasks);
+    }
+    // a thread is woken up only if some threads are idle. As the number of
+    // queued tasks is incremented before reading the number of idle threads
+    // and idle threads increment this number before checking for queued
+    // tasks, at least one of them sees the modification of the other.
+    if (this->number_of_idle_workers.load() != 0) {
+      {
+        std::lock_guard<std::mutex> lock(this->m);
+      }
+      this->c.notify_one();
+    }
+  }  // end of ThreadPool::push
+
+  void ThreadPool::pushToWorker(const size_type i, std::unique_ptr<Task> t) {
+    if (i >= this->queues.size()) {
+      mgis::raise("ThreadPool::addTaskToWorker: invalid worker index");
+    }
+    {
+      auto& q = *(this->queues[i]);
+      std::lock_guard<std::mutex> lock(q.m);
+      if (this->stop) {
+        mgis::raise(
+            "ThreadPool::addTaskToWorker: "
+            "enqueue on stopped ThreadPool");
+      }
+      q.pinned_tasks.push_back(std::move(t));
+      ++(this->number_of_unfinished_tasks);
+      ++(q.number_of_pinned_tasks);
+    }
+    // the idle thread woken up by `notify_one` may not be the right one
+    if (this->number_of_idle_workers.load() != 0) {
+      {
+        std::lock_guard<std::mutex> lock(this->m);
       }
+      this->c.notify_all();
     }
+  }  // end of ThreadPool::pushToWorker
+
+  bool ThreadPool::hasTask(const size_type i) const {
+    return (this->number_of_queued_tasks.load() != 0) ||
+           (this->queues[i]->number_of_pinned_tasks.load() != 0);
+  }  // end of ThreadPool::hasTask
+
+  std::unique_ptr<ThreadPool::Task> ThreadPool::pop(const size_type i) {
+    const auto n = this->queues.size();
+    if (!this->hasTask(i)) {
+      return nullptr;
+    }
+    // the tasks added to this thread are treated first
+    {
+      auto& q = *(this->queues[i]);
+      std::lock_guard<std::mutex> lock(q.m);
+      if (!q.pinned_tasks.empty()) {
+        auto t = std::move(q.pinned_tasks.front());
+        q.pinned_tasks.pop_front();
+        --(q.number_of_pinned_tasks);
+        return t;
+      }
+    }
+    // the thread first treats its own queue, starting from the most recent
+    // task, and then steals the oldest tasks of the other queues
+    for (size_type k = 0; k != n; ++k) {
+      auto& q = *(this->queues[(i + k) % n]);
+      std::lock_guard<std::mutex> lock(q.m);
+      if (q.tasks.empty()) {
+        continue;
+      }
+      auto t = std::unique_ptr<Task>{};
+      if (k == 0) {
+        t = std::move(q.tasks.back());
+        q.tasks.pop_back();
+      } else {
+        t = std::move(q.tasks.front());
+        q.tasks.pop_front();
+      }
+      --(this->number_of_queued_tasks);
+      return t;
+    }
+    return nullptr;
+  }  // end of ThreadPool::pop
+
+  void ThreadPool::wait() {
+    std::unique_lock<std::mutex> lock(this->m);
+    this->finished.wait(lock, [this] {
+      return this->number_of_unfinished_tasks.load() == 0;
+    });
   }  // end of ThreadPool::wait()
 
-  ThreadPool::~ThreadPool() {
+  void ThreadPool::stopWorkers() {
     {
       std::unique_lock<std::mutex> lock(m);
       this->stop = true;
     }
     this->c.notify_all();
-    // the destructor joins all threads
     for (auto &w : this->workers) {
       w.join();
     }
+  }  // end of ThreadPool::stopWorkers
+
+  ThreadPool::~ThreadPool() {
+    // the destructor joins all threads
+    this->stopWorkers();
   }
 
 }  // end of namespace mgis
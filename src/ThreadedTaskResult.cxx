@@ -47,7 +47,7 @@ namespace mgis {
     this->eptr = e;
   }  // end of ThreadedTaskResult<void>::setException
 
-  void ThreadedTaskResult<void>::rethrow() {
+  void ThreadedTaskResult<void>::rethrow() const {
     if (this->eptr == nullptr) {
       ThreadedTaskResultBase::throwNullException();
     }
@@ -0,0 +1,108 @@
+/*!
+ * \file   src/Topology.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <string>
+#include <cstring>
+#include <algorithm>
+#include <cstdlib>
+#ifdef __linux__
+#include <sched.h>
+#include <dirent.h>
+#include <pthread.h>
+#endif /* __linux__ */
+#include "MGIS/Raise.hxx"
+#include "MGIS/Topology.hxx"
+
+namespace mgis {
+
+  bool isThreadAffinitySupported() {
+#ifdef __linux__
+    return true;
+#else  /* __linux__ */
+    return false;
+#endif /* __linux__ */
+  }  // end of isThreadAffinitySupported
+
+  std::vector<size_type> getAvailableCPUs() {
+    auto cpus = std::vector<size_type>{};
+#ifdef __linux__
+    cpu_set_t s;
+    CPU_ZERO(&s);
+    if (::sched_getaffinity(0, sizeof(cpu_set_t), &s) == 0) {
+      for (size_type i = 0; i != CPU_SETSIZE; ++i) {
+        if (CPU_ISSET(i, &s)) {
+          cpus.push_back(i);
+        }
+      }
+    }
+#endif /* __linux__ */
+    if (cpus.empty()) {
+      const auto n = std::max(std::thread::hardware_concurrency(), 1u);
+      for (size_type i = 0; i != n; ++i) {
+        cpus.push_back(i);
+      }
+    }
+    return cpus;
+  }  // end of getAvailableCPUs
+
+  std::optional<size_type> getNUMANode(const size_type cpu) {
+#ifdef __linux__
+    // the directory associated with a processor contains a link named
+    // `nodeX` where `X` is the NUMA node
+    const auto d = "/sys/devices/system/cpu/cpu" + std::to_string(cpu);
+    auto* const dir = ::opendir(d.c_str());
+    if (dir == nullptr) {
+      return {};
+    }
+    auto node = std::optional<size_type>{};
+    while (const auto* const e = ::readdir(dir)) {
+      if ((std::strncmp(e->d_name, "node", 4) == 0) &&
+          (e->d_name[4] >= '0') && (e->d_name[4] <= '9')) {
+        node = static_cast<size_type>(std::strtoul(e->d_name + 4, nullptr, 10));
+        break;
+      }
+    }
+    ::closedir(dir);
+    return node;
+#else  /* __linux__ */
+    static_cast<void>(cpu);
+    return {};
+#endif /* __linux__ */
+  }  // end of getNUMANode
+
+  void bindThreadToCPU(std::thread& t, const size_type cpu) {
+#ifdef __linux__
+    if (cpu >= CPU_SETSIZE) {
+      mgis::raise("bindThreadToCPU: invalid processor index '" +
+                  std::to_string(cpu) + "'");
+    }
+    cpu_set_t s;
+    CPU_ZERO(&s);
+    CPU_SET(cpu, &s);
+    const auto r =
+        ::pthread_setaffinity_np(t.native_handle(), sizeof(cpu_set_t), &s);
+    if (r != 0) {
+      mgis::raise("bindThreadToCPU: can't bind thread to processor '" +
+                  std::to_string(cpu) + "' (" + std::strerror(r) + ")");
+    }
+#else  /* __linux__ */
+    static_cast<void>(t);
+    static_cast<void>(cpu);
+    mgis::raise(
+        "bindThreadToCPU: "
+        "binding threads to processors is not supported on this system");
+#endif /* __linux__ */
+  }  // end of bindThreadToCPU
+
+}  // end of namespace mgis
@@ -14,6 +14,7 @@
 
 #include <bitset>
 #include <climits>
+#include <string_view>
 #include "MGIS/Raise.hxx"
 #include "MGIS/Behaviour/Variable.hxx"
 
@@ -338,6 +339,128 @@ namespace mgis::behaviour {
     raise("getVariableOffset: no variable named '" + std::string(n) + "'");
   }  // end of getVariableOffset
 
+  static std::size_t hashVariableName(const string_view n) {
+    return std::hash<std::string_view>{}(std::string_view(n.data(), n.size()));
+  }  // end of hashVariableName
+
+  VariablesIndex buildVariablesIndex(const std::vector<Variable> &vs,
+                                     const Hypothesis h) {
+    auto i = VariablesIndex{};
+    i.hypothesis = h;
+    i.locations.reserve(vs.size());
+    i.names.reserve(vs.size());
+    for (const auto &v : vs) {
+      const auto pos = static_cast<size_type>(i.locations.size());
+      const auto s = getVariableSize(v, h);
+      i.locations.push_back({pos, i.array_size, s, v.type,
+                             v.type_identifier});
+      i.names.insert({hashVariableName(v.name), pos});
+      i.array_size += s;
+    }
+    return i;
+  }  // end of buildVariablesIndex
+
+  /*!
+   * \return true if the types of the first `e` variables match the types
+   * stored in the index.
+   * \param[in] vs: variables
+   * \param[in] i: index of the variables
+   * \param[in] e: number of variables to be checked
+   *
+   * \note the index is assumed to contain at least `e` locations.
+   */
+  static bool haveIndexedTypes(const std::vector<Variable> &vs,
+                               const VariablesIndex &i,
+                               const size_type e) {
+    for (size_type k = 0; k != e; ++k) {
+      const auto &l = i.locations[k];
+      if ((vs[k].type != l.type) ||
+          (vs[k].type_identifier != l.type_identifier)) {
+        return false;
+      }
+    }
+    return true;
+  }  // end of haveIndexedTypes
+
+  /*!
+   * \return the location of the given variable, or a null pointer if the
+   * variable is not found or if the index is not consistent with the list
+   * of variables.
+   * \param[in] vs: variables
+   * \param[in] i: index of the variables
+   * \param[in] n: variable name
+   *
+   * \note the offset of a variable depends on the types of the preceding
+   * variables, which are thus also checked.
+   */
+  static const VariableLocation *findVariableLocation(
+      const std::vector<Variable> &vs,
+      const VariablesIndex &i,
+      const string_view n) {
+    if (i.locations.size() != vs.size()) {
+      return nullptr;
+    }
+    const auto r = i.names.equal_range(hashVariableName(n));
+    for (auto p = r.first; p != r.second; ++p) {
+      if (vs[p->second].name == n) {
+        if (!haveIndexedTypes(vs, i, p->second + 1)) {
+          return nullptr;
+        }
+        return &(i.locations[p->second]);
+      }
+    }
+    return nullptr;
+  }  // end of findVariableLocation
+
+  bool contains(const std::vector<Variable> &vs,
+                const VariablesIndex &i,
+                const string_view n) {
+    if (i.locations.size() != vs.size()) {
+      return contains(vs, n);
+    }
+    // the types of the variables are irrelevant here
+    const auto r = i.names.equal_range(hashVariableName(n));
+    for (auto p = r.first; p != r.second; ++p) {
+      if (vs[p->second].name == n) {
+        return true;
+      }
+    }
+    return false;
+  }  // end of contains
+
+  const Variable &getVariable(const std::vector<Variable> &vs,
+                              const VariablesIndex &i,
+                              const string_view n) {
+    const auto l = findVariableLocation(vs, i, n);
+    if (l != nullptr) {
+      return vs[l->index];
+    }
+    return getVariable(vs, n);
+  }  // end of getVariable
+
+  size_type getArraySize(const std::vector<Variable> &vs,
+                         const VariablesIndex &i,
+                         const Hypothesis h) {
+    if ((i.hypothesis == h) && (i.locations.size() == vs.size()) &&
+        (haveIndexedTypes(vs, i, static_cast<size_type>(vs.size())))) {
+      return i.array_size;
+    }
+    return getArraySize(vs, h);
+  }  // end of getArraySize
+
+  size_type getVariableOffset(const std::vector<Variable> &vs,
+                              const VariablesIndex &i,
+                              const string_view n,
+                              const Hypothesis h) {
+    if (i.hypothesis == h) {
+      const auto l = findVariableLocation(vs, i, n);
+      if (l != nullptr) {
+        return l->offset;
+      }
+    }
+    return getVariableOffset(vs, n, h);
+  }  // end of getVariableOffset
+
   std::string getVariableTypeSymbolicRepresentation(const int id) {
     auto t = id;
     const auto s = internals::getVariableTypeSymbolicRepresentation(t);
@@ -0,0 +1,183 @@
+/*!
+ * \file   AsynchronousIntegrationTest.cxx
+ * \brief  This test checks the `integrateAsynchronously` function and the
+ * `AsynchronousBehaviourIntegration` class.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <utility>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include "MGIS/Partition.hxx"
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Behaviour/State.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  auto success = true;
+  auto check = [&success](const bool b, const std::string& msg) {
+    if (!b) {
+      std::cerr << "AsynchronousIntegrationTest: " << msg << '\n';
+      success = false;
+    }
+    return b;
+  };
+  if (argc != 2) {
+    std::cerr << "AsynchronousIntegrationTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+  try {
+    constexpr const auto n = mgis::size_type{100};
+    constexpr const auto nth = mgis::size_type{3};
+    const auto b = load(argv[1], "Norton", Hypothesis::TRIDIMENSIONAL);
+    ThreadPool p{nth};
+    const auto dt = real(180);
+    auto make_manager = [&] {
+      auto m = std::make_unique<MaterialDataManager>(b, n);
+      m->s1.external_state_variables["Temperature"] = 293.15;
+      update(*m);
+      for (size_type idx = 0; idx != m->n; ++idx) {
+        const auto e = 5.e-5 * (1 + idx % 3);
+        m->s1.gradients[idx * m->s1.gradients_stride] = e;
+      }
+      return m;
+    };
+    auto same_state = [](const MaterialDataManager& m1,
+                         const MaterialDataManager& m2) {
+      return std::equal(m1.s1.thermodynamic_forces.begin(),
+                        m1.s1.thermodynamic_forces.end(),
+                        m2.s1.thermodynamic_forces.begin()) &&
+             std::equal(m1.s1.internal_state_variables.begin(),
+                        m1.s1.internal_state_variables.end(),
+                        m2.s1.internal_state_variables.begin());
+    };
+    for (const auto policy :
+         {SchedulingPolicy::STATIC, SchedulingPolicy::WORK_STEALING}) {
+      const auto name = std::string(
+          policy == SchedulingPolicy::STATIC ? "static" : "work stealing");
+      auto opts = BehaviourIntegrationOptions{};
+      opts.integration_type = IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR;
+      opts.scheduling.policy = policy;
+      opts.scheduling.grain_size = 7;
+      // expected number of chunks
+      const auto blocks = getUniformPartition(n, nth);
+      auto nchunks = size_type{};
+      for (size_type i = 0; i != nth; ++i) {
+        const auto s = blocks[i + 1] - blocks[i];
+        nchunks += (policy == SchedulingPolicy::STATIC)
+                       ? 1
+                       : (s + opts.scheduling.grain_size - 1) /
+                             opts.scheduling.grain_size;
+      }
+      // the callback blocks until the main thread allows the integration to
+      // finish
+      auto go = std::promise<void>{};
+      auto can_finish = go.get_future().share();
+      auto chunks = std::vector<std::pair<size_type, size_type>>{};
+      std::mutex chunks_mutex;
+      auto callback = [&chunks, &chunks_mutex, can_finish](
+                          const size_type cb, const size_type ce,
+                          const BehaviourIntegrationResult&) {
+        {
+          auto lock = std::lock_guard<std::mutex>{chunks_mutex};
+          chunks.push_back({cb, ce});
+        }
+        can_finish.wait();
+      };
+      auto m = make_manager();
+      auto a = integrateAsynchronously(p, *m, opts, dt, callback);
+      check(!a.poll(),
+            "the integration shall not be finished before the callbacks "
+            "return (" + name + ")");
+      go.set_value();
+      a.wait();
+      check(a.poll(), "the integration shall be finished (" + name + ")");
+      const auto r = a.get();
+      try {
+        a.get();
+        check(false, "the result can only be retrieved once (" + name + ")");
+      } catch (std::exception&) {
+      }
+      // every chunk is reported once and the chunks cover all the
+      // integration points without overlapping
+      std::sort(chunks.begin(), chunks.end());
+      check(chunks.size() == nchunks,
+            "invalid number of chunks (" + name + ")");
+      auto next = size_type{0};
+      for (const auto& [cb, ce] : chunks) {
+        check(cb == next, "invalid chunk (" + name + ")");
+        check(ce > cb, "empty chunk (" + name + ")");
+        next = ce;
+      }
+      check(next == n, "the chunks do not cover all the integration points (" +
+                           name + ")");
+      // comparison with the blocking version
+      auto m2 = make_manager();
+      const auto r2 = integrate(p, *m2, opts, dt);
+      check(r.exit_status == r2.exit_status,
+            "invalid exit status (" + name + ")");
+      check(r.failures.empty(), "unexpected failure (" + name + ")");
+      check(r.results.size() == r2.results.size(),
+            "invalid number of results (" + name + ")");
+      check(same_state(*m, *m2),
+            "the asynchronous and blocking integrations differ (" + name + ")");
+    }
+    // the move assignment waits for the end of the integration previously
+    // handled by the target
+    {
+      auto opts = BehaviourIntegrationOptions{};
+      opts.integration_type = IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR;
+      auto go = std::promise<void>{};
+      auto can_finish = go.get_future().share();
+      std::atomic<size_type> ntreated{0};
+      auto m1 = make_manager();
+      auto m2 = make_manager();
+      auto a = integrateAsynchronously(
+          p, *m1, opts, dt,
+          [&ntreated, can_finish](const size_type cb, const size_type ce,
+                                  const BehaviourIntegrationResult&) {
+            can_finish.wait();
+            ntreated += ce - cb;
+          });
+      // the first integration is allowed to finish while the main thread is
+      // blocked in the move assignment
+      auto t = std::thread([&go] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        go.set_value();
+      });
+      a = integrateAsynchronously(p, *m2, opts, dt);
+      check(ntreated == n,
+            "the move assignment did not wait for the end of the previous "
+            "integration");
+      const auto r = a.get();
+      check(r.exit_status == 1, "integration failed");
+      check(same_state(*m1, *m2), "invalid results");
+      t.join();
+    }
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,95 @@
+/*!
+ * \file   BehaviourCacheTest.cxx
+ * \brief  This test checks the cache of the descriptions of the behaviours
+ * used by the `load` functions.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include "MGIS/Behaviour/Behaviour.hxx"
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  constexpr const auto h = Hypothesis::TRIDIMENSIONAL;
+  auto success = true;
+  auto check = [&success](const bool b, const std::string& msg) {
+    if (!b) {
+      std::cerr << "BehaviourCacheTest: " << msg << '\n';
+      success = false;
+    }
+    return b;
+  };
+  if (argc != 2) {
+    std::cerr << "BehaviourCacheTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+  try {
+    clearBehaviourCache();
+    check(getBehaviourCacheSize() == 0, "the cache shall be empty");
+    // a repeated load is served from the cache
+    const auto b1 = load(argv[1], "Norton", h);
+    check(getBehaviourCacheSize() == 1, "the behaviour has not been cached");
+    const auto b2 = load(argv[1], "Norton", h);
+    check(getBehaviourCacheSize() == 1,
+          "the behaviour has been loaded twice");
+    check((b1.behaviour == b2.behaviour) && (b1.b == b2.b) &&
+              (b1.isvs.size() == b2.isvs.size()) &&
+              (getArraySize(b1.isvs, h) == getArraySize(b2.isvs, h)),
+          "the cached description differs from the loaded one");
+    // the modelling hypothesis is part of the key of the cache
+    load(argv[1], "Norton", Hypothesis::AXISYMMETRICAL);
+    check(getBehaviourCacheSize() == 2,
+          "the modelling hypothesis shall be part of the key of the cache");
+    // the finite strain options are part of the key of the cache
+    auto o = FiniteStrainBehaviourOptions{};
+    o.stress_measure = FiniteStrainBehaviourOptions::PK1;
+    o.tangent_operator = FiniteStrainBehaviourOptions::DPK1_DF;
+    const auto pk1 = load(o, argv[1], "FiniteStrainSingleCrystal", h);
+    o.stress_measure = FiniteStrainBehaviourOptions::CAUCHY;
+    o.tangent_operator = FiniteStrainBehaviourOptions::DSIG_DF;
+    const auto cauchy = load(o, argv[1], "FiniteStrainSingleCrystal", h);
+    check(getBehaviourCacheSize() == 4,
+          "the finite strain options shall be part of the key of the cache");
+    if (check((pk1.thermodynamic_forces.size() == 1) &&
+                  (cauchy.thermodynamic_forces.size() == 1),
+              "invalid number of thermodynamic forces")) {
+      check(pk1.thermodynamic_forces[0].name == "FirstPiolaKirchhoffStress",
+            "invalid thermodynamic force (PK1)");
+      check(cauchy.thermodynamic_forces[0].name == "Stress",
+            "invalid thermodynamic force (Cauchy)");
+      check(pk1.thermodynamic_forces[0].type !=
+                cauchy.thermodynamic_forces[0].type,
+            "the thermodynamic forces shall differ");
+    }
+    o.stress_measure = FiniteStrainBehaviourOptions::PK1;
+    o.tangent_operator = FiniteStrainBehaviourOptions::DPK1_DF;
+    const auto pk1_2 = load(o, argv[1], "FiniteStrainSingleCrystal", h);
+    check(getBehaviourCacheSize() == 4, "the behaviour has been loaded twice");
+    check((pk1_2.thermodynamic_forces.size() == 1) &&
+              (pk1_2.thermodynamic_forces[0].name ==
+               "FirstPiolaKirchhoffStress"),
+          "invalid thermodynamic force (PK1, cached)");
+    // clearing the cache
+    clearBehaviourCache();
+    check(getBehaviourCacheSize() == 0, "the cache has not been cleared");
+    const auto b3 = load(argv[1], "Norton", h);
+    check(getBehaviourCacheSize() == 1, "the behaviour has not been cached");
+    check((b3.behaviour == b1.behaviour) && (b3.b == b1.b),
+          "the reloaded description differs from the first one");
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
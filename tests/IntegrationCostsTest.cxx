@@ -0,0 +1,121 @@
+/*!
+ * \file   IntegrationCostsTest.cxx
+ * \brief  This test checks that the multi-threaded integrations use the
+ * integration costs recorded during the previous integration to split the
+ * integration points between the threads.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cmath>
+#include <mutex>
+#include <vector>
+#include <utility>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include "MGIS/Partition.hxx"
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Behaviour/State.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  auto success = true;
+  auto check = [&success](const bool b, const char* const msg) {
+    if (!b) {
+      std::cerr << "IntegrationCostsTest: " << msg << '\n';
+      success = false;
+    }
+    return b;
+  };
+  auto check_load_imbalance =
+      [&check](const MultiThreadedBehaviourIntegrationResult& r) {
+        check(std::isfinite(r.load_imbalance), "non finite load imbalance");
+        check(r.load_imbalance >= 1, "invalid load imbalance");
+      };
+  if (argc != 2) {
+    std::cerr << "IntegrationCostsTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+  try {
+    constexpr const auto n = mgis::size_type{100};
+    constexpr const auto nth = mgis::size_type{3};
+    const auto b = load(argv[1], "Norton", Hypothesis::TRIDIMENSIONAL);
+    ThreadPool p{nth};
+    auto opts = BehaviourIntegrationOptions{};
+    opts.integration_type = IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR;
+    opts.scheduling.policy = SchedulingPolicy::STATIC;
+    MaterialDataManager m{b, n};
+    check(m.integration_costs.empty(),
+          "the integration costs shall not be allocated by default");
+    m.allocateArrayOfIntegrationCosts();
+    check(m.integration_costs.size() == n,
+          "invalid size of the array of integration costs");
+    m.s1.external_state_variables["Temperature"] = 293.15;
+    update(m);
+    // the strain increment varies along the integration points, so that
+    // their costs differ
+    for (size_type idx = 0; idx != m.n; ++idx) {
+      m.s1.gradients[idx * m.s1.gradients_stride] =
+          (idx < n / 2) ? 5.e-5 : 1.e-4;
+    }
+    const auto dt = real(180);
+    // first integration: the costs are recorded
+    const auto r1 = integrate(p, m, opts, dt);
+    check(r1.exit_status == 1, "first integration failed");
+    check_load_imbalance(r1);
+    check(std::all_of(m.integration_costs.begin(), m.integration_costs.end(),
+                      [](const real c) { return c >= 0; }),
+          "invalid integration cost");
+    // second integration: the blocks associated with the threads shall be
+    // built from the costs recorded by the first integration. With the
+    // `STATIC` policy, each chunk reported to the callback is one of those
+    // blocks.
+    const auto costs = std::vector<real>(m.integration_costs.begin(),
+                                         m.integration_costs.end());
+    const auto expected = getCostBasedPartition(costs, nth);
+    auto chunks = std::vector<std::pair<size_type, size_type>>{};
+    auto chunks_mutex = std::mutex{};
+    auto a = integrateAsynchronously(
+        p, m, opts, dt,
+        [&chunks, &chunks_mutex](const size_type cb, const size_type ce,
+                                 const BehaviourIntegrationResult&) {
+          auto lock = std::lock_guard<std::mutex>{chunks_mutex};
+          chunks.push_back({cb, ce});
+        });
+    const auto r2 = a.get();
+    check(r2.exit_status == 1, "second integration failed");
+    check_load_imbalance(r2);
+    std::sort(chunks.begin(), chunks.end());
+    if (check(chunks.size() == nth, "invalid number of chunks")) {
+      for (size_type i = 0; i != nth; ++i) {
+        check(chunks[i].first == expected[i],
+              "the blocks are not based on the integration costs");
+        check(chunks[i].second == expected[i + 1],
+              "the blocks are not based on the integration costs");
+      }
+    }
+    // releasing the costs restores the uniform partition
+    m.releaseArrayOfIntegrationCosts();
+    check(m.integration_costs.empty(),
+          "the integration costs shall have been released");
+    const auto r3 = integrate(p, m, opts, dt);
+    check(r3.exit_status == 1, "third integration failed");
+    check_load_imbalance(r3);
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,136 @@
+/*!
+ * \file   IntegrationFailuresTest.cxx
+ * \brief  This test checks that all the integration points are treated when
+ * the `stop_on_failure` member of the `BehaviourIntegrationOptions`
+ * structure is false, and that the failures are properly reported.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Behaviour/State.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  auto success = true;
+  auto check = [&success](const bool b, const std::string& msg) {
+    if (!b) {
+      std::cerr << "IntegrationFailuresTest: " << msg << '\n';
+      success = false;
+    }
+    return b;
+  };
+  if (argc != 2) {
+    std::cerr << "IntegrationFailuresTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+  try {
+    constexpr const auto n = mgis::size_type{100};
+    const auto b = load(argv[1], "Norton", Hypothesis::TRIDIMENSIONAL);
+    ThreadPool p{3};
+    const auto o =
+        getVariableOffset(b.isvs, "EquivalentViscoplasticStrain", b.hypothesis);
+    // integration points for which the integration fails
+    const auto failing = std::vector<size_type>{3, 17, 42, 43, 77, 99};
+    const auto de = 5.e-5;
+    const auto dt = real(180);
+    // value of the equivalent viscoplastic strain after the first time
+    // step of IntegrateTest3
+    const auto p_ref = real(1.3523277308229e-11);
+    auto is_failing = [&failing](const size_type i) {
+      return std::find(failing.begin(), failing.end(), i) != failing.end();
+    };
+    auto test = [&](const std::string& name,
+                    const SchedulingPolicy policy, const bool threaded) {
+      auto opts = BehaviourIntegrationOptions{};
+      opts.integration_type = IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR;
+      opts.scheduling.policy = policy;
+      opts.scheduling.grain_size = 7;
+      opts.stop_on_failure = false;
+      MaterialDataManager m{b, n};
+      m.s1.external_state_variables["Temperature"] = 293.15;
+      update(m);
+      for (size_type idx = 0; idx != m.n; ++idx) {
+        // a huge strain increment makes the integration fail
+        m.s1.gradients[idx * m.s1.gradients_stride] =
+            is_failing(idx) ? 1.e6 : de;
+        // this value is overwritten if the integration point is treated
+        const auto pos = idx * m.s1.internal_state_variables_stride + o;
+        m.s1.internal_state_variables[pos] = -1;
+      }
+      auto exit_status = int{};
+      auto failures = std::vector<BehaviourIntegrationFailure>{};
+      if (threaded) {
+        const auto r = integrate(p, m, opts, dt);
+        exit_status = r.exit_status;
+        failures = r.failures;
+        // the failures reported by each thread
+        auto nfailures = std::size_t{};
+        for (const auto& ri : r.results) {
+          check(std::is_sorted(ri.failures.begin(), ri.failures.end(),
+                               [](const auto& f1, const auto& f2) {
+                                 return f1.n < f2.n;
+                               }),
+                "unsorted failures in the results of a thread (" + name + ")");
+          nfailures += ri.failures.size();
+        }
+        check(nfailures == failing.size(),
+              "invalid number of failures in the results of the threads (" +
+                  name + ")");
+      } else {
+        const auto r = integrate(m, opts, dt, 0, m.n);
+        exit_status = r.exit_status;
+        failures = r.failures;
+        check(r.n == failing.front(),
+              "the first failure is not reported (" + name + ")");
+      }
+      check(exit_status == -1, "invalid exit status (" + name + ")");
+      if (check(failures.size() == failing.size(),
+                "invalid number of failures (" + name + ")")) {
+        for (size_type i = 0; i != failing.size(); ++i) {
+          check(failures[i].n == failing[i],
+                "invalid failure (" + name + ")");
+          check(failures[i].exit_status == -1,
+                "invalid exit status of a failure (" + name + ")");
+        }
+      }
+      // all the other integration points have been treated
+      for (size_type idx = 0; idx != m.n; ++idx) {
+        if (is_failing(idx)) {
+          continue;
+        }
+        const auto pv = m.s1.internal_state_variables
+                            [idx * m.s1.internal_state_variables_stride + o];
+        if (!check(std::abs(pv - p_ref) < 1.e-12,
+                   "integration point " + std::to_string(idx) +
+                       " has not been treated (" + name + ")")) {
+          break;
+        }
+      }
+    };
+    test("sequential", SchedulingPolicy::STATIC, false);
+    test("static", SchedulingPolicy::STATIC, true);
+    test("work stealing", SchedulingPolicy::WORK_STEALING, true);
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,303 @@
+/*!
+ * \file   IntegrationPointsSelectionTest.cxx
+ * \brief  This test checks the overloads of the `integrate`,
+ * `executeInitializeFunction` and `executePostProcessing` functions
+ * treating a subset of the integration points, given by a list of indices or
+ * by a mask.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include <functional>
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Behaviour/State.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  auto success = true;
+  auto check = [&success](const bool b, const std::string& msg) {
+    if (!b) {
+      std::cerr << "IntegrationPointsSelectionTest: " << msg << '\n';
+      success = false;
+    }
+    return b;
+  };
+  auto check_throw = [&check](const std::function<void()>& f,
+                              const std::string& msg) {
+    try {
+      f();
+    } catch (std::exception&) {
+      return;
+    }
+    check(false, msg);
+  };
+  if (argc != 2) {
+    std::cerr << "IntegrationPointsSelectionTest: invalid number of "
+                 "arguments\n";
+    std::exit(-1);
+  }
+  try {
+    constexpr const auto n = mgis::size_type{100};
+    constexpr const auto h = Hypothesis::TRIDIMENSIONAL;
+    ThreadPool p{3};
+    // the indices are not sorted
+    const auto indices =
+        std::vector<size_type>{71, 3, 40, 12, 99, 0, 55, 56, 13};
+    auto mask = std::vector<bool>(n, false);
+    for (const auto i : indices) {
+      mask[i] = true;
+    }
+    // invalid indices, sorted or not
+    const auto duplicated = std::vector<size_type>{3, 5, 3};
+    const auto sorted_duplicated = std::vector<size_type>{3, 5, 5, 8};
+    const auto out_of_range = std::vector<size_type>{n, 2};
+    const auto sorted_out_of_range = std::vector<size_type>{2, 7, n};
+    const auto invalid_mask = std::vector<bool>(n - 1, true);
+    auto static_scheduling = SchedulingOptions{};
+    static_scheduling.policy = SchedulingPolicy::STATIC;
+    auto work_stealing = SchedulingOptions{};
+    work_stealing.policy = SchedulingPolicy::WORK_STEALING;
+    work_stealing.grain_size = 2;
+    const auto schedulings = {static_scheduling, work_stealing};
+    // check that the given values are equal for all integration points
+    auto check_values = [&check](const std::vector<real>& v,
+                                 const std::vector<real>& v_ref,
+                                 const std::string& msg) {
+      check(v == v_ref, msg);
+    };
+    auto as_vector = [](const mgis::span<const real> v) {
+      return std::vector<real>(v.begin(), v.end());
+    };
+    // first component of the stress at the end of the time step
+    auto sxx = [](const MaterialDataManager& m, const size_type i) {
+      return m.s1.thermodynamic_forces[i * m.s1.thermodynamic_forces_stride];
+    };
+    /* integrate */
+    {
+      const auto b = load(argv[1], "Norton", h);
+      const auto o = getVariableOffset(b.isvs, "EquivalentViscoplasticStrain",
+                                       b.hypothesis);
+      // value of the equivalent viscoplastic strain after the first time
+      // step of IntegrateTest3
+      const auto p_ref = real(1.3523277308229e-11);
+      auto opts = BehaviourIntegrationOptions{};
+      opts.integration_type = IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR;
+      auto make_manager = [&] {
+        auto m = std::make_unique<MaterialDataManager>(b, n);
+        m->s1.external_state_variables["Temperature"] = 293.15;
+        update(*m);
+        for (size_type idx = 0; idx != n; ++idx) {
+          m->s1.gradients[idx * m->s1.gradients_stride] = 5.e-5;
+          m->s1.internal_state_variables
+              [idx * m->s1.internal_state_variables_stride + o] = -1;
+        }
+        return m;
+      };
+      const auto dt = real(180);
+      // reference: list of indices
+      auto mref = make_manager();
+      const auto r = integrate(*mref, opts, dt, indices);
+      check(r.exit_status == 1, "integration failed");
+      for (size_type idx = 0; idx != n; ++idx) {
+        const auto ip = " (integration point " + std::to_string(idx) + ")";
+        const auto& isvs = mref->s1.internal_state_variables;
+        const auto pv = isvs[idx * mref->s1.internal_state_variables_stride +
+                             o];
+        if (mask[idx]) {
+          check(std::abs(pv - p_ref) < 1.e-12,
+                "invalid equivalent viscoplastic strain" + ip);
+          check(sxx(*mref, idx) > 0, "invalid stress" + ip);
+        } else {
+          check(pv == -1, "unselected integration point treated" + ip);
+          check(sxx(*mref, idx) == 0,
+                "unselected integration point treated" + ip);
+        }
+      }
+      const auto isvs_ref = as_vector(mref->s1.internal_state_variables);
+      const auto sig_ref = as_vector(mref->s1.thermodynamic_forces);
+      auto check_manager = [&](const MaterialDataManager& m,
+                               const std::string& msg) {
+        check_values(as_vector(m.s1.internal_state_variables), isvs_ref,
+                     "invalid internal state variables (" + msg + ")");
+        check_values(as_vector(m.s1.thermodynamic_forces), sig_ref,
+                     "invalid thermodynamic forces (" + msg + ")");
+      };
+      {
+        auto m = make_manager();
+        check(integrate(*m, opts, dt, mask).exit_status == 1,
+              "integration failed (mask)");
+        check_manager(*m, "mask");
+      }
+      for (const auto& s : schedulings) {
+        opts.scheduling = s;
+        auto m = make_manager();
+        check(integrate(p, *m, opts, dt, indices).exit_status == 1,
+              "integration failed (threaded, indices)");
+        check_manager(*m, "threaded, indices");
+        auto m2 = make_manager();
+        check(integrate(p, *m2, opts, dt, mask).exit_status == 1,
+              "integration failed (threaded, mask)");
+        check_manager(*m2, "threaded, mask");
+      }
+      auto m = make_manager();
+      check_throw([&] { integrate(*m, opts, dt, duplicated); },
+                  "duplicated indices shall be rejected");
+      check_throw([&] { integrate(p, *m, opts, dt, duplicated); },
+                  "duplicated indices shall be rejected (threaded)");
+      check_throw([&] { integrate(p, *m, opts, dt, sorted_duplicated); },
+                  "duplicated indices shall be rejected (sorted)");
+      check_throw([&] { integrate(p, *m, opts, dt, out_of_range); },
+                  "out of range indices shall be rejected");
+      check_throw([&] { integrate(p, *m, opts, dt, sorted_out_of_range); },
+                  "out of range indices shall be rejected (sorted)");
+      check_throw([&] { integrate(*m, opts, dt, invalid_mask); },
+                  "invalid mask shall be rejected");
+      check_throw([&] { integrate(p, *m, opts, dt, invalid_mask); },
+                  "invalid mask shall be rejected (threaded)");
+    }
+    /* executeInitializeFunction */
+    {
+      const auto b = load(argv[1], "InitializeFunctionTest", h);
+      const auto f = std::string{"StressFromInitialPressure"};
+      constexpr auto pr = mgis::real{-1.2e5};
+      const auto inputs = std::vector<real>{pr};
+      auto make_manager = [&] {
+        auto m = std::make_unique<MaterialDataManager>(b, n);
+        m->s1.external_state_variables["Temperature"] = 293.15;
+        update(*m);
+        return m;
+      };
+      auto mref = make_manager();
+      check(executeInitializeFunction(*mref, f, inputs, indices).exit_status !=
+                -1,
+            "initialize function failed");
+      for (size_type idx = 0; idx != n; ++idx) {
+        const auto ip = " (integration point " + std::to_string(idx) + ")";
+        check(sxx(*mref, idx) == (mask[idx] ? pr : 0), "invalid stress" + ip);
+      }
+      const auto sig_ref = as_vector(mref->s1.thermodynamic_forces);
+      {
+        auto m = make_manager();
+        check(executeInitializeFunction(*m, f, inputs, mask).exit_status != -1,
+              "initialize function failed (mask)");
+        check_values(as_vector(m->s1.thermodynamic_forces), sig_ref,
+                     "invalid thermodynamic forces (mask)");
+      }
+      for (const auto& s : schedulings) {
+        auto m = make_manager();
+        check(executeInitializeFunction(p, *m, f, inputs, indices, s)
+                      .exit_status != -1,
+              "initialize function failed (threaded, indices)");
+        check_values(as_vector(m->s1.thermodynamic_forces), sig_ref,
+                     "invalid thermodynamic forces (threaded, indices)");
+        auto m2 = make_manager();
+        check(executeInitializeFunction(p, *m2, f, inputs, mask, s)
+                      .exit_status != -1,
+              "initialize function failed (threaded, mask)");
+        check_values(as_vector(m2->s1.thermodynamic_forces), sig_ref,
+                     "invalid thermodynamic forces (threaded, mask)");
+      }
+      auto m = make_manager();
+      check_throw(
+          [&] { executeInitializeFunction(*m, f, inputs, duplicated); },
+          "duplicated indices shall be rejected (initialize function)");
+      check_throw(
+          [&] {
+            executeInitializeFunction(p, *m, f, inputs, duplicated,
+                                      static_scheduling);
+          },
+          "duplicated indices shall be rejected (threaded initialize "
+          "function)");
+    }
+    /* executePostProcessing */
+    {
+      const auto b = load(argv[1], "PostProcessingTest", h);
+      const auto f = std::string{"PrincipalStrain"};
+      auto make_manager = [&] {
+        auto m = std::make_unique<MaterialDataManager>(b, n);
+        setMaterialProperty(m->s1, "YoungModulus", 150e9);
+        setMaterialProperty(m->s1, "PoissonRatio", 0.3);
+        m->s1.external_state_variables["Temperature"] = 293.15;
+        for (size_type idx = 0; idx != n; ++idx) {
+          auto* const e = m->s1.gradients.data() + idx * m->s1.gradients_stride;
+          e[0] = 1.e-3 * idx;
+          e[1] = 2.e-3 * idx;
+          e[2] = 3.e-3 * idx;
+        }
+        update(*m);
+        return m;
+      };
+      auto mref = make_manager();
+      auto outputs_ref = std::vector<real>(3 * n, -1);
+      check(executePostProcessing(outputs_ref, *mref, f, indices).exit_status !=
+                -1,
+            "post-processing failed");
+      for (size_type idx = 0; idx != n; ++idx) {
+        const auto ip = " (integration point " + std::to_string(idx) + ")";
+        for (size_type c = 0; c != 3; ++c) {
+          const auto v = outputs_ref[3 * idx + c];
+          if (mask[idx]) {
+            check(std::abs(v - 1.e-3 * (c + 1) * idx) < 1.e-12,
+                  "invalid principal strain" + ip);
+          } else {
+            check(v == -1, "unselected integration point treated" + ip);
+          }
+        }
+      }
+      {
+        auto m = make_manager();
+        auto outputs = std::vector<real>(3 * n, -1);
+        check(executePostProcessing(outputs, *m, f, mask).exit_status != -1,
+              "post-processing failed (mask)");
+        check_values(outputs, outputs_ref, "invalid outputs (mask)");
+      }
+      for (const auto& s : schedulings) {
+        auto m = make_manager();
+        auto outputs = std::vector<real>(3 * n, -1);
+        check(executePostProcessing(outputs, p, *m, f, indices, s)
+                      .exit_status != -1,
+              "post-processing failed (threaded, indices)");
+        check_values(outputs, outputs_ref,
+                     "invalid outputs (threaded, indices)");
+        auto outputs2 = std::vector<real>(3 * n, -1);
+        check(executePostProcessing(outputs2, p, *m, f, mask, s).exit_status !=
+                  -1,
+              "post-processing failed (threaded, mask)");
+        check_values(outputs2, outputs_ref, "invalid outputs (threaded, mask)");
+      }
+      auto m = make_manager();
+      auto outputs = std::vector<real>(3 * n, -1);
+      check_throw(
+          [&] { executePostProcessing(outputs, *m, f, duplicated); },
+          "duplicated indices shall be rejected (post-processing)");
+      check_throw(
+          [&] {
+            executePostProcessing(outputs, p, *m, f, duplicated,
+                                  static_scheduling);
+          },
+          "duplicated indices shall be rejected (threaded post-processing)");
+    }
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,189 @@
+/*!
+ * \file   IntegrationProfileTest.cxx
+ * \brief  This test checks the statistics collected by the `integrate`
+ * functions when the `profile` member of the `BehaviourIntegrationOptions`
+ * structure is true.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cmath>
+#include <algorithm>
+#include <string>
+#include <numeric>
+#include <cstdlib>
+#include <sstream>
+#include <iostream>
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Behaviour/State.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  auto success = true;
+  auto check = [&success](const bool b, const std::string& msg) {
+    if (!b) {
+      std::cerr << "IntegrationProfileTest: " << msg << '\n';
+      success = false;
+    }
+    return b;
+  };
+  if (argc != 2) {
+    std::cerr << "IntegrationProfileTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+  try {
+    constexpr const auto n = mgis::size_type{100};
+    const auto b = load(argv[1], "Norton", Hypothesis::TRIDIMENSIONAL);
+    ThreadPool p{3};
+    const auto dt = real(180);
+    // integration points for which the integration fails
+    auto is_failing = [](const size_type i) { return i % 10 == 3; };
+    const auto nfailures = n / 10;
+    auto initialize = [&is_failing](MaterialDataManager& m,
+                                    const bool failures) {
+      m.s1.external_state_variables["Temperature"] = 293.15;
+      update(m);
+      for (size_type idx = 0; idx != m.n; ++idx) {
+        // a huge strain increment makes the integration fail
+        m.s1.gradients[idx * m.s1.gradients_stride] =
+            (failures && is_failing(idx)) ? 1.e6 : 5.e-5;
+      }
+    };
+    // consistency of a profile
+    auto check_profile = [&check](const BehaviourIntegrationProfile& pr,
+                                  const size_type nip, const size_type nf,
+                                  const std::string& name) {
+      check(pr.number_of_integration_points == nip,
+            "invalid number of integration points (" + name + ")");
+      check(pr.number_of_failures == nf,
+            "invalid number of failures (" + name + ")");
+      check(pr.number_of_unreliable_results <= nip,
+            "invalid number of unreliable results (" + name + ")");
+      check(std::accumulate(pr.rdt_histogram.begin(), pr.rdt_histogram.end(),
+                            size_type{0}) == nip,
+            "the histogram of the time step increase factors does not sum "
+            "to the number of integration points (" +
+                name + ")");
+      check((pr.behaviour_time >= 0) && (pr.data_access_time >= 0),
+            "invalid times (" + name + ")");
+      // the time spent in the behaviour and in accessing the data are
+      // measured during the treatment of the integration points
+      check(pr.behaviour_time + pr.data_access_time <= pr.wall_time,
+            "inconsistent times (" + name + ")");
+      if (nip != 0) {
+        check(pr.wall_time > 0, "invalid wall time (" + name + ")");
+        check(getNumberOfIntegrationPointsPerSecond(pr) > 0,
+              "invalid number of integration points per second (" + name +
+                  ")");
+      }
+    };
+    // sum of the profiles of the threads
+    auto check_merged_profile =
+        [&check](const MultiThreadedBehaviourIntegrationResult& r,
+                 const std::string& name) {
+      auto nip = size_type{};
+      auto nur = size_type{};
+      auto nf = size_type{};
+      auto wall_time = real{};
+      auto hist = BehaviourIntegrationProfile{}.rdt_histogram;
+      for (const auto& ri : r.results) {
+        nip += ri.profile.number_of_integration_points;
+        nur += ri.profile.number_of_unreliable_results;
+        nf += ri.profile.number_of_failures;
+        wall_time += ri.profile.wall_time;
+        for (size_type i = 0; i != hist.size(); ++i) {
+          hist[i] += ri.profile.rdt_histogram[i];
+        }
+      }
+      check(r.profile.number_of_integration_points == nip,
+            "the number of integration points of the threads does not sum "
+            "to the merged one (" +
+                name + ")");
+      check(r.profile.number_of_unreliable_results == nur,
+            "the number of unreliable results of the threads does not sum "
+            "to the merged one (" +
+                name + ")");
+      check(r.profile.number_of_failures == nf,
+            "the number of failures of the threads does not sum to the "
+            "merged one (" +
+                name + ")");
+      check(r.profile.rdt_histogram == hist,
+            "the histograms of the threads do not sum to the merged one (" +
+                name + ")");
+      check(std::abs(r.profile.wall_time - wall_time) <=
+                1.e-12 * std::max(wall_time, real(1)),
+            "the wall times of the threads do not sum to the merged one (" +
+                name + ")");
+    };
+    for (const auto failures : {false, true}) {
+      const auto nf = failures ? nfailures : size_type{0};
+      const auto suffix = failures ? std::string{", with failures"} : "";
+      auto opts = BehaviourIntegrationOptions{};
+      opts.integration_type = IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR;
+      opts.stop_on_failure = false;
+      // no statistics are collected by default
+      {
+        MaterialDataManager m{b, n};
+        initialize(m, failures);
+        const auto r = integrate(m, opts, dt, 0, m.n);
+        check_profile(r.profile, 0, 0, "no profiling" + suffix);
+        check(r.profile.wall_time == 0, "invalid wall time (no profiling)");
+      }
+      opts.profile = true;
+      {
+        MaterialDataManager m{b, n};
+        initialize(m, failures);
+        const auto r = integrate(m, opts, dt, 0, m.n);
+        check(r.failures.size() == nf, "invalid number of failures");
+        check_profile(r.profile, n, nf, "sequential" + suffix);
+        auto os = std::ostringstream{};
+        print_markdown(os, r.profile, 1);
+        check(!os.str().empty(), "empty profile report");
+      }
+      for (const auto policy :
+           {SchedulingPolicy::STATIC, SchedulingPolicy::WORK_STEALING}) {
+        const auto name =
+            (policy == SchedulingPolicy::STATIC ? std::string{"static"}
+                                                : "work stealing") +
+            suffix;
+        opts.scheduling.policy = policy;
+        opts.scheduling.grain_size = 7;
+        MaterialDataManager m{b, n};
+        initialize(m, failures);
+        const auto r = integrate(p, m, opts, dt);
+        check(r.failures.size() == nf,
+              "invalid number of failures (" + name + ")");
+        check(r.results.size() == p.getNumberOfThreads(),
+              "invalid number of results (" + name + ")");
+        check_profile(r.profile, n, nf, name);
+        check_merged_profile(r, name);
+        for (const auto& ri : r.results) {
+          check(ri.profile.rdt_histogram.size() ==
+                    BehaviourIntegrationProfile::rdt_histogram_size,
+                "invalid histogram size (" + name + ")");
+          check(std::accumulate(ri.profile.rdt_histogram.begin(),
+                                ri.profile.rdt_histogram.end(), size_type{0}) ==
+                    ri.profile.number_of_integration_points,
+                "the histogram of a thread does not sum to its number of "
+                "integration points (" +
+                    name + ")");
+        }
+      }
+    }
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
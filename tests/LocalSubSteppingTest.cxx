@@ -0,0 +1,176 @@
+/*!
+ * \file   LocalSubSteppingTest.cxx
+ * \brief  This test checks the local sub-stepping of the `integrate`
+ * functions (see the `maximum_number_of_substeps` member of the
+ * `BehaviourIntegrationOptions` structure).
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cmath>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Behaviour/State.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  auto success = true;
+  auto check = [&success](const bool b, const std::string& msg) {
+    if (!b) {
+      std::cerr << "LocalSubSteppingTest: " << msg << '\n';
+      success = false;
+    }
+    return b;
+  };
+  if (argc != 2) {
+    std::cerr << "LocalSubSteppingTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+  try {
+    constexpr const auto n = mgis::size_type{100};
+    const auto b = load(argv[1], "Norton", Hypothesis::TRIDIMENSIONAL);
+    if (std::find(b.usparams.begin(), b.usparams.end(), "iterMax") ==
+        b.usparams.end()) {
+      std::cerr << "LocalSubSteppingTest: "
+                << "the maximum number of iterations is not a parameter\n";
+      return EXIT_FAILURE;
+    }
+    ThreadPool p{3};
+    auto opts = BehaviourIntegrationOptions{};
+    opts.integration_type = IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR;
+    opts.scheduling.policy = SchedulingPolicy::WORK_STEALING;
+    opts.scheduling.grain_size = 7;
+    opts.stop_on_failure = false;
+    const auto o =
+        getVariableOffset(b.isvs, "EquivalentViscoplasticStrain", b.hypothesis);
+    // the loading of IntegrateTest3: 20 time steps of 180 seconds with a
+    // strain increment of 5e-5
+    const auto de = 5.e-5;
+    const auto dt = real(180);
+    constexpr const auto nsteps = size_type{20};
+    auto initialize = [](MaterialDataManager& m) {
+      m.s1.external_state_variables["Temperature"] = 293.15;
+      update(m);
+    };
+    auto setStrain = [](MaterialDataManager& m, const size_type i,
+                        const real e) {
+      m.s1.gradients[i * m.s1.gradients_stride] = e;
+    };
+    // reference, computed with the time steps of IntegrateTest3
+    MaterialDataManager mref{b, n};
+    initialize(mref);
+    for (size_type i = 0; i != nsteps; ++i) {
+      for (size_type idx = 0; idx != n; ++idx) {
+        setStrain(mref, idx, (i + 1) * de);
+      }
+      const auto r = integrate(p, mref, opts, dt);
+      if (!check(r.exit_status != -1, "integration failed (reference)")) {
+        return EXIT_FAILURE;
+      }
+      check(r.number_of_substeps.empty(),
+            "no local sub-stepping expected (reference)");
+      update(mref);
+    }
+    const auto p_ref = mref.s0.internal_state_variables[o];
+    // the maximum number of iterations of the implicit scheme is reduced, so
+    // that the whole loading can't be applied in one time step
+    setParameter(b, "iterMax", static_cast<unsigned short>(10));
+    // the whole loading is applied in one time step
+    MaterialDataManager m{b, n};
+    initialize(m);
+    for (size_type idx = 0; idx != n; ++idx) {
+      setStrain(m, idx, nsteps * de);
+    }
+    const auto r0 = integrate(p, m, opts, nsteps * dt);
+    check(r0.exit_status == -1,
+          "the integration was expected to fail without local sub-stepping");
+    check(r0.number_of_substeps.empty(),
+          "no local sub-stepping expected when it is disabled");
+    revert(m);
+    for (size_type idx = 0; idx != n; ++idx) {
+      setStrain(m, idx, nsteps * de);
+    }
+    opts.maximum_number_of_substeps = 100;
+    const auto r1 = integrate(p, m, opts, nsteps * dt);
+    if (!check(r1.exit_status != -1,
+               "integration failed with local sub-stepping")) {
+      return EXIT_FAILURE;
+    }
+    // all integration points shall have been sub-stepped
+    if (check(r1.number_of_substeps.size() == n,
+              "invalid number of sub-stepped integration points")) {
+      for (size_type idx = 0; idx != n; ++idx) {
+        const auto& [i, nsubsteps] = r1.number_of_substeps[idx];
+        check(i == idx, "invalid sub-stepped integration point");
+        check(nsubsteps > 1, "invalid number of sub-steps");
+        check(nsubsteps <= opts.maximum_number_of_substeps,
+              "invalid number of sub-steps");
+      }
+    }
+    std::cerr.precision(14);
+    for (size_type idx = 0; idx != n; ++idx) {
+      const auto pv = m.s1.internal_state_variables
+                          [idx * m.s1.internal_state_variables_stride + o];
+      if (!check(std::abs(pv - p_ref) < 1.e-3 * p_ref,
+                 "invalid value for the equivalent viscoplastic strain")) {
+        std::cerr << "LocalSubSteppingTest: expected '" << p_ref
+                  << "', computed '" << pv << "'\n";
+        break;
+      }
+    }
+    // Local sub-stepping gives up at one integration point out of two for
+    // which the loading is doubled: the first sub-step is at least as
+    // severe as the whole loading above, so at most one sub-step succeeds.
+    opts.maximum_number_of_substeps = 2;
+    MaterialDataManager m2{b, n};
+    initialize(m2);
+    for (size_type idx = 0; idx != n; ++idx) {
+      setStrain(m2, idx, (idx % 2 == 0) ? de : 2 * nsteps * de);
+    }
+    const auto r2 = integrate(p, m2, opts, nsteps * dt);
+    check(r2.exit_status == -1, "the integration was expected to fail");
+    check(std::is_sorted(r2.number_of_substeps.begin(),
+                         r2.number_of_substeps.end()),
+          "the sub-stepped integration points are not sorted");
+    for (size_type idx = 0; idx != n; ++idx) {
+      const auto pos = std::find_if(
+          r2.number_of_substeps.begin(), r2.number_of_substeps.end(),
+          [idx](const auto& s) { return s.first == idx; });
+      const auto failed =
+          std::any_of(r2.failures.begin(), r2.failures.end(),
+                      [idx](const auto& f) { return f.n == idx; });
+      const auto ip = " (integration point " + std::to_string(idx) + ")";
+      if (idx % 2 == 0) {
+        check(!failed, "unexpected failure" + ip);
+        check((pos == r2.number_of_substeps.end()) || (pos->second != 0),
+              "unexpected failure of the local sub-stepping" + ip);
+      } else {
+        check(failed, "failure expected" + ip);
+        if (check(pos != r2.number_of_substeps.end(),
+                  "local sub-stepping expected" + ip)) {
+          check(pos->second == 0,
+                "the local sub-stepping was expected to give up" + ip);
+        }
+      }
+    }
+    check(r2.failures.size() == n / 2, "invalid number of failures");
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -72,6 +72,28 @@ int main(const int argc, const char* const* argv) {
             "invalid name for the third internal state variable");
       check(d.isvs[3].type == Variable::SCALAR,
             "invalid type for the fourth internal state variable");
+      // lookup through the index of the internal state variables
+      check(getArraySize(d.isvs, d.isvs_index, h) == 9,
+            "invalid size of the internal state variables");
+      check(getVariableOffset(d.isvs, d.isvs_index, "Porosity", h) == 8,
+            "invalid offset for the fourth internal state variable");
+      check(&getVariable(d.isvs, d.isvs_index, "Porosity") == &d.isvs[3],
+            "invalid variable returned for the fourth internal state "
+            "variable");
+      check(!contains(d.isvs, d.isvs_index, "UnknownVariable"),
+            "unexpected internal state variable");
+      // the index shall not be used if a type is modified in place
+      auto isvs = d.isvs;
+      isvs[0].type = Variable::SCALAR;
+      isvs[0].type_identifier = 0;
+      check(getArraySize(isvs, d.isvs_index, h) == 4,
+            "invalid size of the modified internal state variables");
+      check(getVariableOffset(isvs, d.isvs_index, "Porosity", h) == 3,
+            "invalid offset for the fourth modified internal state variable");
+      check(getVariableOffset(isvs, d.isvs_index, isvs[0].name, h) == 0,
+            "invalid offset for the first modified internal state variable");
+      check(contains(isvs, d.isvs_index, "Porosity"),
+            "the fourth internal state variable shall be found");
     }
     if (check(d.esvs.size() == 1,
               "invalid number of external state variables")) {
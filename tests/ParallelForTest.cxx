@@ -0,0 +1,212 @@
+/*!
+ * \file   ParallelForTest.cxx
+ * \brief  This test checks the `parallel_for` and `parallel_reduce`
+ * functions with the static and work-stealing scheduling policies.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include "MGIS/Partition.hxx"
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/ParallelFor.hxx"
+
+int main() {
+  using namespace mgis;
+  auto success = true;
+  auto check = [&success](const bool b, const std::string& msg) {
+    if (!b) {
+      std::cerr << "ParallelForTest: " << msg << '\n';
+      success = false;
+    }
+    return b;
+  };
+  // an exception thrown by a task
+  struct TaskException : std::runtime_error {
+    using std::runtime_error::runtime_error;
+  };
+  try {
+    constexpr const auto nth = size_type{4};
+    constexpr const auto n = size_type{10007};
+    ThreadPool p{nth};
+    // scheduling options tested
+    auto options = std::vector<SchedulingOptions>{};
+    options.push_back(SchedulingOptions{});
+    for (const auto g : {size_type{0}, size_type{1}, size_type{7},
+                         size_type{64}, size_type{100000}}) {
+      auto o = SchedulingOptions{};
+      o.policy = SchedulingPolicy::WORK_STEALING;
+      o.grain_size = g;
+      options.push_back(o);
+    }
+    auto name = [](const SchedulingOptions& o) {
+      if (o.policy == SchedulingPolicy::STATIC) {
+        return std::string{" (static)"};
+      }
+      return " (work stealing, grain size " + std::to_string(o.grain_size) +
+             ")";
+    };
+    // partitions tested: uniform, with empty blocks and with more blocks
+    // than threads
+    auto partitions = std::vector<std::vector<size_type>>{};
+    partitions.push_back(getUniformPartition(n, nth));
+    partitions.push_back({0, 0, 10, 10, 5000, n});
+    partitions.push_back(getUniformPartition(n, 3 * nth));
+    for (const auto& o : options) {
+      for (const auto& blocks : partitions) {
+        const auto msg = name(o) + ", " +
+                         std::to_string(blocks.size() - 1) + " blocks";
+        // every index is visited exactly once
+        auto counters = std::make_unique<std::atomic<size_type>[]>(n);
+        for (size_type i = 0; i != n; ++i) {
+          counters[i] = 0;
+        }
+        std::atomic<bool> invalid_worker_index{false};
+        parallel_for(p, blocks, o,
+                     [&](const size_type w, const size_type b,
+                         const size_type e) {
+                       if ((w >= nth) || (p.getCurrentWorkerIndex() != w)) {
+                         invalid_worker_index = true;
+                       }
+                       for (auto i = b; i != e; ++i) {
+                         ++(counters[i]);
+                       }
+                     });
+        check(!invalid_worker_index, "invalid worker index" + msg);
+        for (size_type i = 0; i != n; ++i) {
+          if (!check(counters[i] == 1, "index " + std::to_string(i) +
+                                           " visited " +
+                                           std::to_string(counters[i]) +
+                                           " times" + msg)) {
+            break;
+          }
+        }
+        // parallel_reduce against a serial sum
+        auto expected = size_type{};
+        for (size_type i = 0; i != n; ++i) {
+          expected += i * i;
+        }
+        const auto sum = parallel_reduce(
+            p, blocks, o, size_type{0},
+            [](const size_type, const size_type b, const size_type e) {
+              auto s = size_type{};
+              for (auto i = b; i != e; ++i) {
+                s += i * i;
+              }
+              return s;
+            },
+            [](const size_type a, const size_type b) { return a + b; });
+        check(sum == expected, "invalid reduction" + msg);
+      }
+    }
+    // the uniform partition overloads
+    {
+      std::atomic<size_type> count{0};
+      parallel_for(p, n,
+                   [&count](const size_type, const size_type b,
+                            const size_type e) { count += e - b; });
+      check(count == n, "invalid number of visited indices");
+      const auto sum = parallel_reduce(
+          p, n, real{0},
+          [](const size_type, const size_type b, const size_type e) {
+            auto s = real{};
+            for (auto i = b; i != e; ++i) {
+              s += real(1) / real(i + 1);
+            }
+            return s;
+          },
+          [](const real a, const real b) { return a + b; });
+      // with the static scheduling policy, the result is deterministic
+      auto expected = real{};
+      const auto blocks = getUniformPartition(n, nth);
+      for (size_type k = 0; k != nth; ++k) {
+        auto s = real{};
+        for (auto i = blocks[k]; i != blocks[k + 1]; ++i) {
+          s += real(1) / real(i + 1);
+        }
+        expected += s;
+      }
+      check(sum == expected, "invalid reduction (uniform partition)");
+    }
+    // early stop with the work-stealing policy: once the function returned
+    // false, no chunk is claimed anymore
+    {
+      auto o = SchedulingOptions{};
+      o.policy = SchedulingPolicy::WORK_STEALING;
+      o.grain_size = 1;
+      std::atomic<size_type> count{0};
+      parallel_for(p, n, o,
+                   [&count](const size_type, const size_type b,
+                            const size_type e) {
+                     count += e - b;
+                     return false;
+                   });
+      // each task treats at most one chunk before noticing the stop
+      check((count != 0) && (count <= nth), "invalid early stop");
+    }
+    // exceptions are only rethrown once all the tasks are finished
+    for (const auto& o : options) {
+      std::atomic<size_type> finished{0};
+      auto caught = false;
+      const auto blocks = getUniformPartition(n, nth);
+      try {
+        parallel_for(p, blocks, o,
+                     [&finished](const size_type, const size_type b,
+                                 const size_type e) {
+                       if (b == 0) {
+                         throw TaskException("first block");
+                       }
+                       std::this_thread::sleep_for(
+                           std::chrono::microseconds(10 * (e - b)));
+                       ++finished;
+                     });
+      } catch (TaskException& e) {
+        caught = std::string{e.what()} == "first block";
+        // no task shall be running anymore
+        const auto f = finished.load();
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        check(f == finished.load(),
+              "some tasks were still running when the exception was "
+              "rethrown" +
+                  name(o));
+      }
+      check(caught, "the exception was not rethrown" + name(o));
+      if (o.policy == SchedulingPolicy::STATIC) {
+        check(finished == nth - 1, "some blocks were not treated" + name(o));
+      }
+    }
+    // the boundaries of the blocks must be sorted
+    auto rejected = [&p](const std::vector<size_type>& blocks) {
+      try {
+        parallel_for(p, blocks, SchedulingOptions{},
+                     [](const size_type, const size_type, const size_type) {});
+      } catch (std::exception&) {
+        return true;
+      }
+      return false;
+    };
+    check(rejected({0, 10, 5, 20}), "unsorted blocks shall be rejected");
+    check(rejected({0}), "invalid partitions shall be rejected");
+    check(rejected({}), "invalid partitions shall be rejected");
+    p.wait();
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
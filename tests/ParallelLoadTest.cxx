@@ -0,0 +1,68 @@
+/*!
+ * \file   ParallelLoadTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis::behaviour;
+  constexpr const auto h = Hypothesis::TRIDIMENSIONAL;
+  bool success = true;
+  auto check = [&success](const bool b, const std::string& msg) {
+    if (!b) {
+      success = false;
+      std::cerr << msg << '\n';
+    }
+    return b;
+  };
+  if (!check(argc == 2, "expected two arguments")) {
+    return EXIT_FAILURE;
+  }
+  const auto l = std::string{argv[1]};
+  try {
+    mgis::ThreadPool p(2);
+    auto requests = std::vector<BehaviourLoadRequest>{};
+    for (const auto& b : {"Norton", "Plasticity", "Elasticity", "Norton"}) {
+      requests.push_back({l, b, h, {}});
+    }
+    requests.push_back(
+        {l, "FiniteStrainSingleCrystal", h, FiniteStrainBehaviourOptions{}});
+    // errors
+    requests.push_back({l, "FiniteStrainSingleCrystal", h, {}});
+    requests.push_back({l, "UnknownBehaviour", h, {}});
+    requests.push_back({"UnknownLibrary", "Norton", h, {}});
+    const auto results = load(p, requests);
+    if (!check(results.size() == requests.size(), "invalid number of results")) {
+      return EXIT_FAILURE;
+    }
+    for (decltype(results.size()) i = 0; i != 5; ++i) {
+      if (check(static_cast<bool>(results[i]),
+                "loading behaviour '" + requests[i].behaviour + "' failed")) {
+        check(results[i]->behaviour == requests[i].behaviour,
+              "invalid behaviour name");
+        check(results[i]->b != nullptr, "invalid function pointer");
+      }
+    }
+    for (decltype(results.size()) i = 5; i != results.size(); ++i) {
+      check(!results[i],
+            "loading behaviour '" + requests[i].behaviour + "' shall fail");
+    }
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,207 @@
+/*!
+ * \file   PersistentBehaviourCacheTest.cxx
+ * \brief  This test checks the persistent cache of the descriptions of the
+ * behaviours. The test runs itself in a second process to check that the
+ * descriptions stored by the first one are used.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cstdio>
+#include <string>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/PersistentBehaviourCache.hxx"
+
+static bool compare(const std::vector<mgis::behaviour::Variable>& v1,
+                    const std::vector<mgis::behaviour::Variable>& v2) {
+  if (v1.size() != v2.size()) {
+    return false;
+  }
+  for (decltype(v1.size()) i = 0; i != v1.size(); ++i) {
+    if ((v1[i].name != v2[i].name) || (v1[i].type != v2[i].type) ||
+        (v1[i].type_identifier != v2[i].type_identifier)) {
+      return false;
+    }
+  }
+  return true;
+}  // end of compare
+
+//! \return the file of the persistent cache associated with a behaviour
+static std::string getCacheFile(
+    const mgis::behaviour::PersistentBehaviourCacheKey& k,
+    const std::string& b,
+    const mgis::behaviour::Hypothesis h) {
+  return k.path + '.' + b + '.' + toString(h) + ".mgis";
+}  // end of getCacheFile
+
+//! \return if the given file exists
+static bool exists(const std::string& f) {
+  return std::ifstream(f).good();
+}  // end of exists
+
+/*!
+ * \brief remove the file of the persistent cache at the end of the test,
+ * whatever the way the test ends.
+ */
+struct CacheFileRemover {
+  ~CacheFileRemover() {
+    if (!file.empty()) {
+      std::remove(file.c_str());
+    }
+  }
+  //! \brief file to be removed
+  std::string file;
+};  // end of struct CacheFileRemover
+
+/*!
+ * \brief test run in a second process: the description of the behaviour
+ * shall be read from the persistent cache written by the first process.
+ */
+static bool checkCacheHit(const std::string& l, const std::string& b) {
+  using namespace mgis::behaviour;
+  constexpr const auto h = Hypothesis::TRIDIMENSIONAL;
+  bool success = true;
+  auto check = [&success](const bool v, const std::string& msg) {
+    if (!v) {
+      success = false;
+      std::cerr << "PersistentBehaviourCacheTest (second process): " << msg
+                << '\n';
+    }
+    return v;
+  };
+  usePersistentBehaviourCache(true);
+  const auto k = internals::getPersistentBehaviourCacheKey(l, b);
+  if ((!check(k.has_value(), "no key associated with the library")) ||
+      (!check(exists(getCacheFile(*k, b, h)), "no cache file"))) {
+    return false;
+  }
+  const auto d = load(l, b, h);
+  // the first process stored a tagged source in the cache, which can't
+  // come from the library
+  check(d.source == "persistent cache", "the cache was not used");
+  check(d.b != nullptr, "the behaviour function was not retrieved");
+  check(!d.postprocessings.empty(), "no post-processing");
+  for (const auto& [n, p] : d.postprocessings) {
+    check(p.f != nullptr,
+          "the post-processing '" + n + "' was not retrieved");
+  }
+  for (const auto& [n, f] : d.initialize_functions) {
+    check(f.f != nullptr,
+          "the initialize function '" + n + "' was not retrieved");
+  }
+  return success;
+}  // end of checkCacheHit
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis::behaviour;
+  constexpr const auto h = Hypothesis::TRIDIMENSIONAL;
+  bool success = true;
+  auto check = [&success](const bool b, const std::string& msg) {
+    if (!b) {
+      success = false;
+      std::cerr << msg << '\n';
+    }
+    return b;
+  };
+  if ((argc == 4) && (std::string(argv[3]) == "--cache-hit")) {
+    try {
+      return checkCacheHit(argv[1], argv[2]) ? EXIT_SUCCESS : EXIT_FAILURE;
+    } catch (std::exception& e) {
+      std::cerr << e.what() << '\n';
+      return EXIT_FAILURE;
+    }
+  }
+  if (!check(argc == 3, "expected three arguments")) {
+    return EXIT_FAILURE;
+  }
+  CacheFileRemover remover;
+  try {
+    check(!isPersistentBehaviourCacheUsed(),
+          "the persistent cache shall be disabled by default");
+    const auto k = internals::getPersistentBehaviourCacheKey(argv[1], argv[2]);
+    if (!check(k.has_value(), "no key associated with the library")) {
+      return EXIT_FAILURE;
+    }
+    check(k->tfel_version == TFEL_VERSION, "invalid TFEL version");
+    // a file left by a previous run is removed
+    remover.file = getCacheFile(*k, argv[2], h);
+    std::remove(remover.file.c_str());
+    usePersistentBehaviourCache(true);
+    const auto d = load(argv[1], argv[2], h);
+    // the description shall have been stored by the load function
+    if (!check(exists(remover.file), "no cache file")) {
+      return EXIT_FAILURE;
+    }
+    const auto c = internals::readPersistentBehaviourCache(*k, argv[2], h);
+    if (!check(c.has_value(), "the behaviour description was not stored")) {
+      return EXIT_FAILURE;
+    }
+    check(c->b == nullptr, "function pointers shall not be stored");
+    check(c->behaviour == d.behaviour, "invalid behaviour name");
+    check(c->function == d.function, "invalid function name");
+    check(c->source == d.source, "invalid source");
+    check(c->btype == d.btype, "invalid behaviour type");
+    check(c->kinematic == d.kinematic, "invalid kinematic");
+    check(c->symmetry == d.symmetry, "invalid symmetry");
+    check(c->options == d.options, "invalid options");
+    check(compare(c->gradients, d.gradients), "invalid gradients");
+    check(compare(c->thermodynamic_forces, d.thermodynamic_forces),
+          "invalid thermodynamic forces");
+    check(compare(c->mps, d.mps), "invalid material properties");
+    check(compare(c->isvs, d.isvs), "invalid internal state variables");
+    check(compare(c->esvs, d.esvs), "invalid external state variables");
+    check(c->params == d.params, "invalid parameters");
+    check(c->postprocessings.size() == d.postprocessings.size(),
+          "invalid number of post-processings");
+    // a modification of the library shall invalidate the description
+    auto k2 = *k;
+    k2.modification_time += 1;
+    check(!internals::readPersistentBehaviourCache(k2, argv[2], h),
+          "outdated descriptions shall be discarded");
+    // invalid streams
+    std::istringstream is("invalid");
+    check(!readBehaviourDescription(is, *k),
+          "invalid descriptions shall be discarded");
+    // huge sizes read from corrupted files shall not be allocated
+    for (const auto& corruption :
+         {std::string{"18446744073709551615 "}, std::string{"1000000000 "}}) {
+      std::istringstream is2("mgis-behaviour-cache 1\n" +
+                             std::to_string(k->path.size()) + ' ' +
+                             k->path + '\n' +
+                             std::to_string(k->modification_time) + '\n' +
+                             corruption);
+      check(!readBehaviourDescription(is2, *k),
+            "corrupted descriptions shall be discarded");
+    }
+    // the description read by a second process. The source is replaced by a
+    // tag to check that the description is read from the cache.
+    {
+      auto tagged = *c;
+      tagged.source = "persistent cache";
+      std::ofstream f(remover.file, std::ios::binary);
+      writeBehaviourDescription(f, *k, tagged);
+    }
+    const auto cmd = '"' + std::string(argv[0]) + "\" \"" + argv[1] +
+                     "\" \"" + argv[2] + "\" --cache-hit";
+    check(std::system(cmd.c_str()) == 0,
+          "the second process failed to use the persistent cache");
+    // the cache file is removed
+    std::remove(remover.file.c_str());
+    check(!exists(remover.file), "the cache file was not removed");
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
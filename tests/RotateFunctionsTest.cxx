@@ -7,8 +7,10 @@
 
 #include <cmath>
 #include <array>
+#include <vector>
 #include <stdexcept>
 #include <iostream>
+#include "MGIS/ThreadPool.hxx"
 #include "MGIS/Behaviour/Behaviour.hxx"
 
 int main(const int argc, const char* const* argv) {
@@ -36,6 +38,20 @@ int main(const int argc, const char* const* argv) {
     assert_equal(me[1], 1);
     assert_equal(me[2], 0);
     assert_equal(me[3], 0);
+    // rotation of a field of gradients using a thread pool
+    constexpr const size_type n = 100;
+    auto p = ThreadPool{2};
+    auto gf = std::vector<real>(4 * n);
+    for (size_type i = 0; i != gf.size(); ++i) {
+      gf[i] = static_cast<real>(i);
+    }
+    auto mf = std::vector<real>(4 * n);
+    auto mf2 = std::vector<real>(4 * n);
+    rotateGradients(mf, b, gf, r);
+    rotateGradients(p, mf2, b, gf, r);
+    for (size_type i = 0; i != mf.size(); ++i) {
+      assert_equal(mf[i], mf2[i]);
+    }
   } catch (std::exception& e) {
     std::cerr << e.what() << '\n';
     return EXIT_FAILURE;
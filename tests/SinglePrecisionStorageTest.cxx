@@ -0,0 +1,189 @@
+/*!
+ * \file   SinglePrecisionStorageTest.cxx
+ * \brief  This test checks that storing the state in single precision (see
+ * the `StateStoragePrecision` enumeration) gives the results obtained with
+ * the default double precision storage within the precision of a `float`.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Behaviour/State.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialStateManager.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  auto success = true;
+  auto check = [&success](const bool b, const std::string& msg) {
+    if (!b) {
+      std::cerr << "SinglePrecisionStorageTest: " << msg << '\n';
+      success = false;
+    }
+    return b;
+  };
+  if (argc != 2) {
+    std::cerr << "SinglePrecisionStorageTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+  try {
+    constexpr const auto n = mgis::size_type{100};
+    const auto b = load(argv[1], "Norton", Hypothesis::TRIDIMENSIONAL);
+    ThreadPool p{2};
+    const auto o =
+        getVariableOffset(b.isvs, "EquivalentViscoplasticStrain", b.hypothesis);
+    // md stores the state in double precision, ms in single precision
+    MaterialDataManager md{b, n};
+    auto i = MaterialDataManagerInitializer{};
+    i.s0.precision = StateStoragePrecision::SINGLE_PRECISION;
+    i.s1.precision = StateStoragePrecision::SINGLE_PRECISION;
+    MaterialDataManager ms{b, n, i};
+    auto has_size = [](const mgis::span<float> v, const size_type vs) {
+      return static_cast<size_type>(v.size()) == n * vs;
+    };
+    for (const auto* const s : {&ms.s0, &ms.s1}) {
+      check(s->precision == StateStoragePrecision::SINGLE_PRECISION,
+            "invalid precision");
+      check(s->gradients.empty() && s->thermodynamic_forces.empty() &&
+                s->internal_state_variables.empty(),
+            "no double precision values expected");
+      check(has_size(s->single_precision_gradients, s->gradients_stride) &&
+                has_size(s->single_precision_thermodynamic_forces,
+                         s->thermodynamic_forces_stride) &&
+                has_size(s->single_precision_internal_state_variables,
+                         s->internal_state_variables_stride),
+            "invalid size of the single precision values");
+    }
+    // comparison of a value computed in single precision with the value
+    // computed in double precision
+    auto is_close = [](const real vs, const real vd, const real eps) {
+      return std::abs(vs - vd) <= 1.e-4 * std::abs(vd) + eps;
+    };
+    auto compare = [&](const std::string& step) {
+      for (size_type idx = 0; idx != n; ++idx) {
+        const auto ip = " (integration point " + std::to_string(idx) + step;
+        for (size_type c = 0; c != md.s1.thermodynamic_forces_stride; ++c) {
+          const auto pos = idx * md.s1.thermodynamic_forces_stride + c;
+          if (!check(is_close(ms.s1.single_precision_thermodynamic_forces[pos],
+                              md.s1.thermodynamic_forces[pos], 1),
+                     "invalid thermodynamic forces" + ip)) {
+            return;
+          }
+        }
+        for (size_type c = 0; c != md.s1.internal_state_variables_stride;
+             ++c) {
+          const auto pos = idx * md.s1.internal_state_variables_stride + c;
+          if (!check(
+                  is_close(ms.s1.single_precision_internal_state_variables[pos],
+                           md.s1.internal_state_variables[pos], 1.e-12),
+                  "invalid internal state variables" + ip)) {
+            return;
+          }
+        }
+      }
+    };
+    // copy of the single precision values of a state
+    auto get_values = [](const MaterialStateManager& s) {
+      auto v = std::vector<float>(s.single_precision_gradients.begin(),
+                                  s.single_precision_gradients.end());
+      v.insert(v.end(), s.single_precision_thermodynamic_forces.begin(),
+               s.single_precision_thermodynamic_forces.end());
+      v.insert(v.end(), s.single_precision_internal_state_variables.begin(),
+               s.single_precision_internal_state_variables.end());
+      return v;
+    };
+    for (auto* const m : {&md, &ms}) {
+      m->s1.external_state_variables["Temperature"] = 293.15;
+      update(*m);
+    }
+    // the loading of IntegrateTest3
+    const auto de = 5.e-5;
+    const auto dt = real(180);
+    for (size_type step = 0; step != 20; ++step) {
+      const auto sstep = ", step " + std::to_string(step) + ")";
+      for (size_type idx = 0; idx != n; ++idx) {
+        const auto e = (step + 1) * de;
+        md.s1.gradients[idx * md.s1.gradients_stride] = e;
+        ms.s1.single_precision_gradients[idx * ms.s1.gradients_stride] =
+            static_cast<float>(e);
+      }
+      const auto rd = integrate(
+          p, md, IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR, dt);
+      const auto rs = integrate(
+          p, ms, IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR, dt);
+      if ((!check(rd == 1, "integration failed (double precision" + sstep)) ||
+          (!check(rs == 1, "integration failed (single precision" + sstep))) {
+        return EXIT_FAILURE;
+      }
+      compare(sstep);
+      // the states are alternatively updated by copying the values
+      // (`update`) or by swapping them (`swapValues`)
+      if (step % 2 == 0) {
+        update(md);
+        update(ms);
+        check(get_values(ms.s0) == get_values(ms.s1),
+              "invalid update" + sstep);
+      } else {
+        const auto vs0 = get_values(ms.s0);
+        const auto vs1 = get_values(ms.s1);
+        if (step % 4 == 1) {
+          swapValues(md.s0, md.s1);
+          swapValues(ms.s0, ms.s1);
+        } else {
+          swapValues(p, md.s0, md.s1);
+          swapValues(p, ms.s0, ms.s1);
+        }
+        check(get_values(ms.s0) == vs1, "invalid swap (s0" + sstep);
+        check(get_values(ms.s1) == vs0, "invalid swap (s1" + sstep);
+      }
+    }
+    // final value of the equivalent viscoplastic strain in IntegrateTest3
+    const auto p_ref = real(0.00056635857064313);
+    // extraction of the equivalent viscoplastic strain
+    auto pd = std::vector<real>(n);
+    auto ps = std::vector<real>(n);
+    auto ps2 = std::vector<real>(n);
+    extractInternalStateVariable(pd, md.s0, "EquivalentViscoplasticStrain");
+    extractInternalStateVariable(ps, ms.s0, "EquivalentViscoplasticStrain");
+    extractInternalStateVariable(p, ps2, ms.s0,
+                                 "EquivalentViscoplasticStrain");
+    check(ps == ps2, "the extracted values depend on the thread pool");
+    std::cerr.precision(14);
+    for (size_type idx = 0; idx != n; ++idx) {
+      const auto ip = " (integration point " + std::to_string(idx) + ")";
+      const auto pos = idx * ms.s0.internal_state_variables_stride + o;
+      check(ps[idx] ==
+                static_cast<real>(
+                    ms.s0.single_precision_internal_state_variables[pos]),
+            "invalid extracted value" + ip);
+      if (!check(is_close(ps[idx], pd[idx], 1.e-12),
+                 "invalid equivalent viscoplastic strain" + ip) ||
+          !check(is_close(ps[idx], p_ref, 1.e-12),
+                 "invalid equivalent viscoplastic strain" + ip)) {
+        std::cerr << "SinglePrecisionStorageTest: expected '" << p_ref
+                  << "', computed '" << ps[idx] << "'\n";
+        break;
+      }
+    }
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,141 @@
+/*!
+ * \file   StaticSchedulingTest.cxx
+ * \brief  This test checks that, with the static scheduling policy, the
+ * integration points are treated by the threads which initialized them
+ * (first-touch initialization of the material states), whatever the load
+ * of the threads of the pool.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include "MGIS/Partition.hxx"
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/ParallelFor.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+
+//! \brief thread pool used by the integration
+static mgis::ThreadPool* pool = nullptr;
+//! \brief index of the worker having treated each integration point
+static std::vector<mgis::size_type> integration_workers;
+
+/*!
+ * \brief a behaviour function recording the worker treating the integration
+ * point. The index of the integration point is stored in the first
+ * component of the gradients.
+ */
+static int recordWorker(mgis_bv_BehaviourDataView* const d) {
+  const auto i = static_cast<mgis::size_type>(d->s1.gradients[0]);
+  integration_workers[i] = pool->getCurrentWorkerIndex().value();
+  return 1;
+}  // end of recordWorker
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  auto success = true;
+  auto check = [&success](const bool b, const std::string& msg) {
+    if (!b) {
+      std::cerr << "StaticSchedulingTest: " << msg << '\n';
+      success = false;
+    }
+    return b;
+  };
+  if (argc != 2) {
+    std::cerr << "StaticSchedulingTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+  try {
+    constexpr const auto n = mgis::size_type{1000};
+    constexpr const auto nth = mgis::size_type{4};
+    ThreadPool p{nth};
+    pool = &p;
+    integration_workers.resize(n);
+    // tasks added to a given worker
+    for (size_type w = 0; w != nth; ++w) {
+      auto r = p.addTaskToWorker(w, [&p] {
+        return p.getCurrentWorkerIndex().value();
+      });
+      const auto rw = r.get();
+      check(rw && (*rw == w), "invalid worker");
+    }
+    try {
+      p.addTaskToWorker(nth, [] {});
+      check(false, "invalid worker index shall be rejected");
+    } catch (std::exception&) {
+    }
+    // worker expected to treat each integration point
+    const auto blocks = getUniformPartition(n, nth);
+    auto expected = std::vector<size_type>(n);
+    for (size_type k = 0; k != nth; ++k) {
+      for (auto i = blocks[k]; i != blocks[k + 1]; ++i) {
+        expected[i] = k;
+      }
+    }
+    auto b = load(argv[1], "Norton", Hypothesis::TRIDIMENSIONAL);
+    b.b = recordWorker;
+    auto i = MaterialDataManagerInitializer{};
+    i.s0.thread_pool = &p;
+    i.s1.thread_pool = &p;
+    MaterialDataManager m{b, n, i};
+    m.s1.external_state_variables["Temperature"] = 293.15;
+    update(m);
+    for (size_type idx = 0; idx != n; ++idx) {
+      m.s1.gradients[idx * m.s1.gradients_stride] = static_cast<real>(idx);
+    }
+    auto opts = BehaviourIntegrationOptions{};
+    opts.integration_type = IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR;
+    for (size_type round = 0; round != 2 * nth; ++round) {
+      const auto sround = " (round " + std::to_string(round) + ")";
+      // one worker is kept busy, so that the other workers would steal the
+      // tasks of its queue if they were allowed to
+      const auto busy = round % nth;
+      auto sleep = p.addTaskToWorker(busy, [] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+      });
+      // the first-touch initialization of the material states uses the
+      // same overload of `parallel_for`
+      auto first_touch_workers = std::vector<size_type>(n);
+      parallel_for(p, n,
+                   [&first_touch_workers](const size_type w,
+                                          const size_type bi,
+                                          const size_type ei) {
+                     for (auto idx = bi; idx != ei; ++idx) {
+                       first_touch_workers[idx] = w;
+                     }
+                   });
+      check(first_touch_workers == expected,
+            "invalid mapping of the blocks of the first-touch "
+            "initialization" +
+                sround);
+      sleep = p.addTaskToWorker(busy, [] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+      });
+      const auto r = integrate(p, m, opts, 1);
+      check(r.exit_status == 1, "integration failed" + sround);
+      check(integration_workers == first_touch_workers,
+            "the integration points are not treated by the threads which "
+            "initialized them" +
+                sround);
+      p.wait();
+    }
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,172 @@
+/*!
+ * \file   SwapBuffersTest.cxx
+ * \brief  This test checks that the `SWAP_BUFFERS` update policy gives the
+ * same results as the default `COPY_VALUES` update policy.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cmath>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <variant>
+#include <iostream>
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Behaviour/State.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  using UpdatePolicy = MaterialDataManager::UpdatePolicy;
+  auto success = true;
+  auto check = [&success](const bool b, const std::string& msg) {
+    if (!b) {
+      std::cerr << "SwapBuffersTest: " << msg << '\n';
+      success = false;
+    }
+    return b;
+  };
+  if (argc != 2) {
+    std::cerr << "SwapBuffersTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+  try {
+    constexpr const auto n = mgis::size_type{100};
+    const auto b = load(argv[1], "Norton", Hypothesis::TRIDIMENSIONAL);
+    ThreadPool p{2};
+    // m1 uses the default update policy, m2 swaps the buffers
+    MaterialDataManager m1{b, n};
+    MaterialDataManager m2{b, n};
+    m2.setUpdatePolicy(UpdatePolicy::SWAP_BUFFERS);
+    check(m1.getUpdatePolicy() == UpdatePolicy::COPY_VALUES,
+          "invalid default update policy");
+    check(m2.getUpdatePolicy() == UpdatePolicy::SWAP_BUFFERS,
+          "invalid update policy");
+    // values of the temperature at the end of the i-th time step
+    auto temperatures = [](const size_type i) {
+      auto T = std::vector<real>(n);
+      for (size_type idx = 0; idx != n; ++idx) {
+        T[idx] = 293.15 + i + real(idx) / n;
+      }
+      return T;
+    };
+    // values of the temperature stored in a state
+    auto getTemperature = [](const MaterialStateManager& s) {
+      const auto& T = s.external_state_variables.at("Temperature");
+      if (std::holds_alternative<real>(T)) {
+        return std::vector<real>(s.n, std::get<real>(T));
+      }
+      if (std::holds_alternative<std::vector<real>>(T)) {
+        return std::get<std::vector<real>>(T);
+      }
+      const auto v = std::get<mgis::span<real>>(T);
+      return std::vector<real>(v.begin(), v.end());
+    };
+    for (auto* const m : {&m1, &m2}) {
+      m->s1.external_state_variables["Temperature"] = 293.15;
+      update(*m);
+    }
+    const auto de = 5.e-5;
+    const auto dt = real(180);
+    for (size_type i = 0; i != 20; ++i) {
+      auto Ti = temperatures(i);
+      for (auto* const m : {&m1, &m2}) {
+        // with the `SWAP_BUFFERS` policy, the gradients at the end of the
+        // time step hold the values of the previous time step and must be
+        // fully rewritten.
+        for (size_type idx = 0; idx != m->n; ++idx) {
+          for (size_type c = 0; c != m->s1.gradients_stride; ++c) {
+            const auto pos = idx * m->s1.gradients_stride + c;
+            m->s1.gradients[pos] = m->s0.gradients[pos];
+          }
+          m->s1.gradients[idx * m->s1.gradients_stride] += de;
+        }
+        // the spatially variable temperature is only set on the state at
+        // the end of the time step
+        if (i == 0) {
+          setExternalStateVariable(m->s1, "Temperature", Ti,
+                                   MaterialStateManager::LOCAL_STORAGE);
+        } else {
+          auto& T = std::get<std::vector<real>>(
+              m->s1.external_state_variables.at("Temperature"));
+          T = Ti;
+        }
+      }
+      const auto isvs0 =
+          std::vector<real>(m2.s0.internal_state_variables.begin(),
+                            m2.s0.internal_state_variables.end());
+      const auto r1 = integrate(
+          p, m1, IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR, dt);
+      const auto r2 = integrate(
+          p, m2, IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR, dt);
+      if ((!check(r1 == 1, "integration failed (COPY_VALUES)")) ||
+          (!check(r2 == 1, "integration failed (SWAP_BUFFERS)"))) {
+        return EXIT_FAILURE;
+      }
+      update(m1);
+      update(m2);
+      const auto step = " at step " + std::to_string(i);
+      // history of the internal state variables
+      for (size_type idx = 0; idx != isvs0.size(); ++idx) {
+        check(std::abs(m1.s0.internal_state_variables[idx] -
+                       m2.s0.internal_state_variables[idx]) < 1.e-14,
+              "invalid internal state variables" + step);
+      }
+      // after the update, the state at the end of the time step holds the
+      // state at the beginning of the previous time step with the
+      // `SWAP_BUFFERS` policy
+      for (size_type idx = 0; idx != isvs0.size(); ++idx) {
+        check(m2.s1.internal_state_variables[idx] == isvs0[idx],
+              "invalid internal state variables at the end of the "
+              "time step" +
+                  step);
+      }
+      // the spatially variable temperature
+      const auto T1_s0 = getTemperature(m1.s0);
+      const auto T1_s1 = getTemperature(m1.s1);
+      const auto T2_s0 = getTemperature(m2.s0);
+      const auto T2_s1 = getTemperature(m2.s1);
+      check(T1_s0 == Ti, "invalid temperature in s0 (COPY_VALUES)" + step);
+      check(T1_s1 == Ti, "invalid temperature in s1 (COPY_VALUES)" + step);
+      check(T2_s0 == Ti, "invalid temperature in s0 (SWAP_BUFFERS)" + step);
+      check(std::holds_alternative<std::vector<real>>(
+                m2.s1.external_state_variables.at("Temperature")),
+            "the temperature shall be spatially variable in s1" + step);
+      if (i == 0) {
+        // the temperature was uniform in s0, so its values were copied
+        check(T2_s1 == Ti, "invalid temperature in s1 (SWAP_BUFFERS)" + step);
+      } else {
+        // the temperature was spatially variable in both states, so their
+        // values were swapped: s1 holds the previous values of s0
+        check(T2_s1 == temperatures(i - 1),
+              "invalid temperature in s1 (SWAP_BUFFERS)" + step);
+      }
+    }
+    // uniform values are copied
+    for (auto* const m : {&m1, &m2}) {
+      m->s1.external_state_variables["Temperature"] = real(300);
+      update(*m);
+      const auto& T0 = m->s0.external_state_variables.at("Temperature");
+      const auto& T1 = m->s1.external_state_variables.at("Temperature");
+      check((std::holds_alternative<real>(T0)) && (std::get<real>(T0) == 300),
+            "invalid uniform temperature in s0");
+      check((std::holds_alternative<real>(T1)) && (std::get<real>(T1) == 300),
+            "invalid uniform temperature in s1");
+    }
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
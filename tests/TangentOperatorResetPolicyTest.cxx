@@ -0,0 +1,187 @@
+/*!
+ * \file   TangentOperatorResetPolicyTest.cxx
+ * \brief  This test checks the policies used to reset the stiffness matrices
+ * of a material data manager (see the `TangentOperatorResetPolicy`
+ * enumeration).
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Behaviour/State.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  using TangentOperatorResetPolicy =
+      MaterialDataManager::TangentOperatorResetPolicy;
+  auto success = true;
+  auto check = [&success](const bool b, const std::string& msg) {
+    if (!b) {
+      std::cerr << "TangentOperatorResetPolicyTest: " << msg << '\n';
+      success = false;
+    }
+    return b;
+  };
+  if (argc != 2) {
+    std::cerr << "TangentOperatorResetPolicyTest: invalid number of "
+                 "arguments\n";
+    std::exit(-1);
+  }
+  try {
+    constexpr const auto n = mgis::size_type{100};
+    const auto b = load(argv[1], "Norton", Hypothesis::TRIDIMENSIONAL);
+    ThreadPool p{2};
+    // me uses the default policy, ml the lazy one
+    MaterialDataManager me{b, n};
+    MaterialDataManager ml{b, n};
+    check(me.getTangentOperatorResetPolicy() ==
+              TangentOperatorResetPolicy::EAGER_RESET,
+          "invalid default tangent operator reset policy");
+    ml.setTangentOperatorResetPolicy(TangentOperatorResetPolicy::LAZY_RESET);
+    check(ml.getTangentOperatorResetPolicy() ==
+              TangentOperatorResetPolicy::LAZY_RESET,
+          "invalid tangent operator reset policy");
+    // integration points for which the integration fails
+    const auto failing = std::vector<size_type>{3, 17, 42, 43, 77, 99};
+    auto is_failing = [&failing](const size_type i) {
+      return std::find(failing.begin(), failing.end(), i) != failing.end();
+    };
+    auto opts = BehaviourIntegrationOptions{};
+    opts.integration_type =
+        IntegrationType::INTEGRATION_CONSISTENT_TANGENT_OPERATOR;
+    opts.stop_on_failure = false;
+    const auto de = 5.e-5;
+    const auto dt = real(180);
+    auto copy = [](const mgis::span<const real> v) {
+      return std::vector<real>(v.begin(), v.end());
+    };
+    auto is_zero = [](const MaterialDataManager& m, const size_type i) {
+      const auto* const K = m.K.data() + i * m.K_stride;
+      return std::all_of(K, K + m.K_stride,
+                         [](const real v) { return v == 0; });
+    };
+    auto all_zero = [&is_zero](const MaterialDataManager& m) {
+      for (size_type i = 0; i != m.n; ++i) {
+        if (!is_zero(m, i)) {
+          return false;
+        }
+      }
+      return true;
+    };
+    // integration over all integration points
+    auto integrate_all = [&](const std::string& msg) {
+      for (auto* const m : {&me, &ml}) {
+        for (size_type idx = 0; idx != m->n; ++idx) {
+          m->s1.gradients[idx * m->s1.gradients_stride] =
+              m->s0.gradients[idx * m->s0.gradients_stride] + de;
+        }
+        const auto r = integrate(p, *m, opts, dt);
+        check(r.exit_status != -1, "integration failed (" + msg + ")");
+      }
+      for (size_type idx = 0; idx != n; ++idx) {
+        check(!is_zero(me, idx), "the stiffness matrix of integration point " +
+                                     std::to_string(idx) +
+                                     " has not been computed (" + msg + ")");
+      }
+      check(copy(me.K) == copy(ml.K),
+            "the stiffness matrices depend on the reset policy (" + msg + ")");
+    };
+    for (auto* const m : {&me, &ml}) {
+      m->s1.external_state_variables["Temperature"] = 293.15;
+      update(*m);
+    }
+    // update and revert
+    for (const auto threaded : {false, true}) {
+      const auto name = std::string(threaded ? "threaded" : "sequential");
+      integrate_all("first integration, " + name);
+      const auto K1 = copy(ml.K);
+      if (threaded) {
+        update(p, me);
+        update(p, ml);
+      } else {
+        update(me);
+        update(ml);
+      }
+      check(all_zero(me), "the stiffness matrices shall be reset by update (" +
+                              name + ")");
+      check(copy(ml.K) == K1,
+            "the stiffness matrices shall not be modified by update (" +
+                name + ")");
+      integrate_all("second integration, " + name);
+      const auto K2 = copy(ml.K);
+      if (threaded) {
+        revert(p, me);
+        revert(p, ml);
+      } else {
+        revert(me);
+        revert(ml);
+      }
+      check(all_zero(me), "the stiffness matrices shall be reset by revert (" +
+                              name + ")");
+      check(copy(ml.K) == K2,
+            "the stiffness matrices shall not be modified by revert (" +
+                name + ")");
+    }
+    // with the lazy reset policy, the stiffness matrices of the integration
+    // points for which the integration failed are filled with zeros
+    for (const auto policy :
+         {SchedulingPolicy::STATIC, SchedulingPolicy::WORK_STEALING}) {
+      const auto name = std::string(
+          policy == SchedulingPolicy::STATIC ? "static" : "work stealing");
+      opts.scheduling.policy = policy;
+      opts.scheduling.grain_size = 7;
+      integrate_all("before failure, " + name);
+      for (auto* const m : {&me, &ml}) {
+        revert(*m);
+        for (size_type idx = 0; idx != m->n; ++idx) {
+          // a huge strain increment makes the integration fail
+          m->s1.gradients[idx * m->s1.gradients_stride] =
+              m->s0.gradients[idx * m->s0.gradients_stride] +
+              (is_failing(idx) ? 1.e6 : de);
+        }
+        const auto r = integrate(p, *m, opts, dt);
+        check(r.exit_status == -1, "integration shall fail (" + name + ")");
+        check(r.failures.size() == failing.size(),
+              "invalid number of failures (" + name + ")");
+      }
+      for (size_type idx = 0; idx != n; ++idx) {
+        const auto ip = " (integration point " + std::to_string(idx) + ", " +
+                        name + ")";
+        if (is_failing(idx)) {
+          check(is_zero(ml, idx),
+                "the stiffness matrix shall be filled with zeros" + ip);
+        } else {
+          check(!is_zero(ml, idx),
+                "the stiffness matrix has not been computed" + ip);
+          check(std::equal(me.K.data() + idx * me.K_stride,
+                           me.K.data() + (idx + 1) * me.K_stride,
+                           ml.K.data() + idx * ml.K_stride),
+                "the stiffness matrices depend on the reset policy" + ip);
+        }
+      }
+      for (auto* const m : {&me, &ml}) {
+        revert(*m);
+      }
+    }
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,146 @@
+/*!
+ * \file   TangentOperatorStorageTest.cxx
+ * \brief  This test checks the packed storage of the tangent operator
+ * blocks.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cmath>
+#include <atomic>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/TangentOperatorStorage.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+
+//! \brief number of calls to `checkZeroTangentOperator` where the stiffness
+//! matrix was not filled with zeros on entry
+static std::atomic<int> non_zero_tangent_operators(0);
+
+/*!
+ * \brief a behaviour function checking that the stiffness matrix is filled
+ * with zeros on entry. The first component holds the integration options.
+ * The stiffness matrix is then filled with non-zero values.
+ */
+static int checkZeroTangentOperator(mgis_bv_BehaviourDataView* const d) {
+  for (int k = 1; k != 36; ++k) {
+    if (d->K[k] != 0) {
+      ++non_zero_tangent_operators;
+      break;
+    }
+  }
+  for (int k = 0; k != 36; ++k) {
+    d->K[k] = 1;
+  }
+  return 1;
+}  // end of checkZeroTangentOperator
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  if (argc != 2) {
+    std::cerr << "TangentOperatorStorageTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+  try {
+    const auto b = load(argv[1], "Elasticity", Hypothesis::TRIDIMENSIONAL);
+    if (getPackedTangentOperatorArraySize(b) != 21) {
+      std::cerr << "TangentOperatorStorageTest: "
+                << "invalid size of the packed tangent operator\n";
+      return EXIT_FAILURE;
+    }
+    auto i = MaterialDataManagerInitializer{};
+    i.tangent_operator_storage =
+        TangentOperatorStorage::PACKED_SYMMETRIC_BLOCKS;
+    MaterialDataManager m1{b, 100};
+    MaterialDataManager m2{b, 100, i};
+    for (auto* const m : {&m1, &m2}) {
+      setMaterialProperty(m->s1, "YoungModulus", 150e9);
+      setMaterialProperty(m->s1, "PoissonRatio", 0.3);
+      setExternalStateVariable(m->s1, "Temperature", 293.15);
+      update(*m);
+      for (size_type ip = 0; ip != m->n; ++ip) {
+        m->s1.gradients[ip * m->s1.gradients_stride] = 1e-3;
+      }
+    }
+    ThreadPool p{2};
+    const auto opts = BehaviourIntegrationOptions{};
+    const auto r1 = integrate(p, m1, opts, 0.1);
+    const auto r2 = integrate(p, m2, opts, 0.1);
+    if ((r1.exit_status != 1) || (r2.exit_status != 1)) {
+      std::cerr << "TangentOperatorStorageTest: integration failed\n";
+      return EXIT_FAILURE;
+    }
+    if (static_cast<mgis::size_type>(m2.K.size()) != 21 * m2.n) {
+      std::cerr << "TangentOperatorStorageTest: "
+                << "invalid size of the packed tangent operator blocks\n";
+      return EXIT_FAILURE;
+    }
+    auto K = std::vector<real>(36 * m2.n);
+    unpackTangentOperatorBlocks(K, m2);
+    for (size_type k = 0; k != K.size(); ++k) {
+      if (std::abs(K[k] - m1.K[k]) > 1e-14 * 150e9) {
+        std::cerr << "TangentOperatorStorageTest: "
+                  << "invalid unpacked tangent operator component (expected '"
+                  << m1.K[k] << "', computed '" << K[k] << "')\n";
+        return EXIT_FAILURE;
+      }
+    }
+    const auto de = std::vector<real>{1e-3, 2e-3, 3e-3, 4e-3, 5e-3, 6e-3};
+    auto ds1 = std::vector<real>(6);
+    auto ds2 = std::vector<real>(6);
+    multiplyByTangentOperator(ds1, m1, 12, de);
+    multiplyByTangentOperator(ds2, m2, 12, de);
+    for (size_type k = 0; k != 6; ++k) {
+      if (std::abs(ds1[k] - ds2[k]) > 1e-14 * 150e9) {
+        std::cerr << "TangentOperatorStorageTest: "
+                  << "invalid product by the tangent operator (expected '"
+                  << ds1[k] << "', computed '" << ds2[k] << "')\n";
+        return EXIT_FAILURE;
+      }
+    }
+    // with the default reset policy, the stiffness matrices are filled with
+    // zeros before each integration, whatever the storage mode
+    auto b2 = b;
+    b2.b = checkZeroTangentOperator;
+    MaterialDataManager m3{b2, 100};
+    MaterialDataManager m4{b2, 100, i};
+    for (auto* const m : {&m3, &m4}) {
+      setMaterialProperty(m->s1, "YoungModulus", 150e9);
+      setMaterialProperty(m->s1, "PoissonRatio", 0.3);
+      setExternalStateVariable(m->s1, "Temperature", 293.15);
+      update(*m);
+      for (const auto threaded : {false, true}) {
+        const auto r = threaded
+                           ? integrate(p, *m, opts, 0.1).exit_status
+                           : integrate(*m, opts, 0.1, 0, m->n).exit_status;
+        if (r != 1) {
+          std::cerr << "TangentOperatorStorageTest: integration failed\n";
+          return EXIT_FAILURE;
+        }
+        update(*m);
+      }
+    }
+    if (non_zero_tangent_operators != 0) {
+      std::cerr << "TangentOperatorStorageTest: the stiffness matrix was not "
+                << "filled with zeros before " << non_zero_tangent_operators
+                << " integrations\n";
+      return EXIT_FAILURE;
+    }
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
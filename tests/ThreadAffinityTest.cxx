@@ -0,0 +1,155 @@
+/*!
+ * \file   ThreadAffinityTest.cxx
+ * \brief  This test checks the functions describing the topology of the
+ * machine and the binding of the threads of a thread pool to the processors
+ * (see the `ThreadPoolOptions` class). Binding is only tested on systems on
+ * which it is supported.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <string>
+#include <utility>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#ifdef __linux__
+#include <sched.h>
+#endif /* __linux__ */
+#include "MGIS/Topology.hxx"
+#include "MGIS/ThreadPool.hxx"
+
+int main() {
+  using namespace mgis;
+  auto success = true;
+  auto check = [&success](const bool b, const std::string& msg) {
+    if (!b) {
+      std::cerr << "ThreadAffinityTest: " << msg << '\n';
+      success = false;
+    }
+    return b;
+  };
+  auto check_throw = [&check](auto f, const std::string& msg) {
+    try {
+      f();
+    } catch (std::exception&) {
+      return;
+    }
+    check(false, msg);
+  };
+  try {
+    // available processors
+    const auto cpus = getAvailableCPUs();
+    check(!cpus.empty(), "no available processor");
+    check(std::adjacent_find(cpus.begin(), cpus.end(),
+                             [](const size_type a, const size_type b) {
+                               return a >= b;
+                             }) == cpus.end(),
+          "the available processors shall be sorted and unique");
+    // the threads of a pool created without options are not bound
+    {
+      ThreadPool p{2};
+      for (size_type i = 0; i != p.getNumberOfThreads(); ++i) {
+        check(!p.getWorkerCPU(i).has_value(), "unexpected processor");
+        check(!p.getWorkerNUMANode(i).has_value(), "unexpected NUMA node");
+      }
+      auto r = p.addTaskToWorker(
+          1, [&p] { return p.getCurrentWorkerNUMANode().has_value(); });
+      const auto has_node = r.get();
+      check(has_node && !*has_node, "unexpected NUMA node (worker)");
+      check(!p.getCurrentWorkerNUMANode().has_value(),
+            "the main thread is not managed by the pool");
+      check_throw([&p] { p.getWorkerCPU(2); },
+                  "invalid worker index shall be rejected (getWorkerCPU)");
+      check_throw(
+          [&p] { p.getWorkerNUMANode(2); },
+          "invalid worker index shall be rejected (getWorkerNUMANode)");
+    }
+    // an empty list of processors is rejected, whatever the system
+    {
+      auto o = ThreadPoolOptions{};
+      o.affinity = ThreadAffinityPolicy::CPU_LIST;
+      check_throw([&o] { ThreadPool p(2, o); },
+                  "an empty list of processors shall be rejected");
+    }
+    if (!isThreadAffinitySupported()) {
+      std::cout << "ThreadAffinityTest: binding threads to processors is "
+                   "not supported on this system\n";
+      return success ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    // check that the workers of the pool are bound to the expected
+    // processors
+    auto check_binding = [&check](const ThreadPool& p,
+                                  const std::vector<size_type>& expected,
+                                  const std::string& msg) {
+      const auto nth = p.getNumberOfThreads();
+      for (size_type i = 0; i != nth; ++i) {
+        const auto w = " (" + msg + ", worker " + std::to_string(i) + ")";
+        const auto cpu = expected[i % expected.size()];
+        check(p.getWorkerCPU(i) == cpu, "invalid processor" + w);
+        check(p.getWorkerNUMANode(i) == getNUMANode(cpu),
+              "invalid NUMA node" + w);
+      }
+    };
+    // check the processor and the NUMA node seen by the workers
+    auto check_workers = [&check](ThreadPool& p, const std::string& msg) {
+      const auto nth = p.getNumberOfThreads();
+      for (size_type i = 0; i != nth; ++i) {
+        const auto w = " (" + msg + ", worker " + std::to_string(i) + ")";
+        auto r = p.addTaskToWorker(i, [&p] {
+#ifdef __linux__
+          const auto cpu = static_cast<size_type>(::sched_getcpu());
+#else  /* __linux__ */
+          const auto cpu = size_type{};
+#endif /* __linux__ */
+          return std::make_pair(cpu, p.getCurrentWorkerNUMANode());
+        });
+        const auto wr = r.get();
+        if (!check(static_cast<bool>(wr), "task failed" + w)) {
+          continue;
+        }
+#ifdef __linux__
+        check(wr->first == p.getWorkerCPU(i),
+              "the worker is not running on its processor" + w);
+#endif /* __linux__ */
+        check(wr->second == p.getWorkerNUMANode(i),
+              "invalid NUMA node of the current worker" + w);
+      }
+    };
+    // round robin: more threads than processors
+    {
+      auto o = ThreadPoolOptions{};
+      o.affinity = ThreadAffinityPolicy::ROUND_ROBIN;
+      ThreadPool p(cpus.size() + 1, o);
+      check_binding(p, cpus, "round robin");
+      check_workers(p, "round robin");
+      check(!p.getCurrentWorkerNUMANode().has_value(),
+            "the main thread is not managed by the pool (round robin)");
+    }
+    // list of processors given by the user
+    {
+      auto o = ThreadPoolOptions{};
+      o.affinity = ThreadAffinityPolicy::CPU_LIST;
+      o.cpus = {cpus.back(), cpus.front()};
+      ThreadPool p(3, o);
+      check_binding(p, o.cpus, "list of processors");
+      check_workers(p, "list of processors");
+      // invalid processor
+      o.cpus = {cpus.front(), size_type{1} << 20};
+      check_throw([&o] { ThreadPool p2(2, o); },
+                  "an invalid processor shall be rejected");
+    }
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,165 @@
+/*!
+ * \file   ThreadPoolStressTest.cxx
+ * \brief  This test submits many tiny tasks to a thread pool, some of them
+ * submitting new tasks from the threads of the pool, and checks that every
+ * task is executed exactly once and that the exceptions thrown by the tasks
+ * are reported through the `ThreadedTaskResult` class.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include "MGIS/ThreadPool.hxx"
+
+int main() {
+  using namespace mgis;
+  auto success = true;
+  auto check = [&success](const bool b, const std::string& msg) {
+    if (!b) {
+      std::cerr << "ThreadPoolStressTest: " << msg << '\n';
+      success = false;
+    }
+    return b;
+  };
+  // tasks whose index is a multiple of those values throw an exception
+  // or submit a new task
+  constexpr const auto throwing = size_type{7};
+  constexpr const auto nesting = size_type{3};
+  // an exception thrown by a task
+  struct TaskException : std::runtime_error {
+    using std::runtime_error::runtime_error;
+  };
+  try {
+    constexpr const auto nth = size_type{4};
+    constexpr const auto ntasks = size_type{10000};
+    ThreadPool p{nth};
+    for (size_type round = 0; round != 10; ++round) {
+      const auto sround = " (round " + std::to_string(round) + ")";
+      // number of executions of each task and of the nested tasks
+      auto counters = std::make_unique<std::atomic<size_type>[]>(2 * ntasks);
+      for (size_type i = 0; i != 2 * ntasks; ++i) {
+        counters[i] = 0;
+      }
+      std::atomic<bool> invalid_worker_index{false};
+      // results of the nested tasks, written by the tasks submitting them
+      auto nested = std::vector<std::future<ThreadedTaskResult<size_type>>>(
+          ntasks);
+      auto task = [&](const size_type i) -> size_type {
+        ++(counters[i]);
+        const auto w = p.getCurrentWorkerIndex();
+        if ((!w.has_value()) || (*w >= nth)) {
+          invalid_worker_index = true;
+        }
+        if (i % nesting == 0) {
+          const auto nested_throws = (i % (nesting * throwing) == 0);
+          nested[i] = p.addTask([&counters, i, nested_throws] {
+            ++(counters[ntasks + i]);
+            if (nested_throws) {
+              throw TaskException("nested task " + std::to_string(i));
+            }
+            return ntasks + i;
+          });
+        }
+        if (i % throwing == 0) {
+          throw TaskException("task " + std::to_string(i));
+        }
+        return i;
+      };
+      auto results = std::vector<std::future<ThreadedTaskResult<size_type>>>{};
+      results.reserve(ntasks);
+      for (size_type i = 0; i != ntasks; ++i) {
+        results.push_back(p.addTask([&task, i] { return task(i); }));
+      }
+      // waiting for the tasks, including the nested ones. Calling `wait`
+      // again must return immediately.
+      p.wait();
+      p.wait();
+      check(!invalid_worker_index, "invalid worker index" + sround);
+      for (size_type i = 0; i != ntasks; ++i) {
+        if (!check(counters[i] == 1, "task " + std::to_string(i) +
+                                         " executed " +
+                                         std::to_string(counters[i]) +
+                                         " times" + sround)) {
+          break;
+        }
+        const auto en = size_type{(i % nesting == 0) ? 1u : 0u};
+        if (!check(counters[ntasks + i] == en,
+                   "invalid number of executions of nested task " +
+                       std::to_string(i) + sround)) {
+          break;
+        }
+      }
+      // the results of the tasks, retrieved after `wait` returned
+      auto check_result = [&check, &sround](
+                              std::future<ThreadedTaskResult<size_type>>& f,
+                              const size_type v, const bool throws,
+                              const std::string& name) {
+        using namespace std::chrono_literals;
+        if (!check(f.valid() && (f.wait_for(0s) == std::future_status::ready),
+                   name + " is not finished" + sround)) {
+          return;
+        }
+        auto r = f.get();
+        if (throws) {
+          check(!r, name + " shall have failed" + sround);
+          try {
+            r.rethrow();
+          } catch (TaskException& e) {
+            check(e.what() == name, "invalid exception" + sround);
+          } catch (...) {
+            check(false, "invalid exception" + sround);
+          }
+        } else {
+          check(r && (*r == v), "invalid result for " + name + sround);
+        }
+      };
+      for (size_type i = 0; i != ntasks; ++i) {
+        const auto si = std::to_string(i);
+        check_result(results[i], i, i % throwing == 0, "task " + si);
+        if (i % nesting == 0) {
+          check_result(nested[i], ntasks + i, i % (nesting * throwing) == 0,
+                       "nested task " + si);
+        }
+      }
+    }
+    // calling `wait` on an idle pool
+    p.wait();
+    // tasks submitted by several external threads while the main thread
+    // repeatedly waits for the pool
+    std::atomic<size_type> counter{0};
+    auto submit = [&p, &counter] {
+      for (size_type i = 0; i != ntasks; ++i) {
+        p.addTask([&counter] { ++counter; });
+      }
+    };
+    auto t1 = std::thread(submit);
+    auto t2 = std::thread(submit);
+    for (size_type i = 0; i != 100; ++i) {
+      p.wait();
+    }
+    t1.join();
+    t2.join();
+    p.wait();
+    check(counter == 2 * ntasks, "invalid number of executed tasks");
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
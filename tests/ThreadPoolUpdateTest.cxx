@@ -0,0 +1,162 @@
+/*!
+ * \file   ThreadPoolUpdateTest.cxx
+ * \brief  This test checks that the overloads of the `update`, `revert`,
+ * `updateValues` and `extractInternalStateVariable` functions using a
+ * thread pool give the same results as the sequential ones.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <variant>
+#include <iostream>
+#include <algorithm>
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Behaviour/State.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialStateManager.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  auto success = true;
+  auto check = [&success](const bool b, const std::string& msg) {
+    if (!b) {
+      std::cerr << "ThreadPoolUpdateTest: " << msg << '\n';
+      success = false;
+    }
+    return b;
+  };
+  if (argc != 2) {
+    std::cerr << "ThreadPoolUpdateTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+  try {
+    constexpr const auto n = mgis::size_type{200};
+    const auto b = load(argv[1], "Gurson", Hypothesis::TRIDIMENSIONAL);
+    ThreadPool p{3};
+    const auto of = getVariableOffset(b.isvs, "Porosity", b.hypothesis);
+    const auto op =
+        getVariableOffset(b.isvs, "EquivalentPlasticStrain", b.hypothesis);
+    // ms is updated by the sequential functions, mp by the ones using the
+    // thread pool
+    MaterialDataManager ms{b, n};
+    MaterialDataManager mp{b, n};
+    auto same_values = [](const mgis::span<const real> v1,
+                          const mgis::span<const real> v2) {
+      return (v1.size() == v2.size()) &&
+             (std::equal(v1.begin(), v1.end(), v2.begin()));
+    };
+    auto same_states = [&same_values](const MaterialStateManager& s1,
+                                      const MaterialStateManager& s2) {
+      return same_values(s1.gradients, s2.gradients) &&
+             same_values(s1.thermodynamic_forces, s2.thermodynamic_forces) &&
+             same_values(s1.internal_state_variables,
+                         s2.internal_state_variables) &&
+             (s1.external_state_variables.at("Temperature") ==
+              s2.external_state_variables.at("Temperature"));
+    };
+    auto compare = [&](const std::string& msg) {
+      check(same_states(ms.s0, mp.s0), "invalid state s0 (" + msg + ")");
+      check(same_states(ms.s1, mp.s1), "invalid state s1 (" + msg + ")");
+      check(same_values(ms.K, mp.K), "invalid tangent operator (" + msg + ")");
+    };
+    // spatially variable temperature and initial porosity
+    auto T = std::vector<real>(n);
+    for (size_type idx = 0; idx != n; ++idx) {
+      T[idx] = 293.15 + real(idx) / n;
+    }
+    for (auto* const m : {&ms, &mp}) {
+      setExternalStateVariable(m->s1, "Temperature", T,
+                               MaterialStateManager::LOCAL_STORAGE);
+      for (size_type idx = 0; idx != n; ++idx) {
+        m->s1.internal_state_variables
+            [idx * m->s1.internal_state_variables_stride + of] =
+            1.e-3 * (1 + idx % 5);
+      }
+    }
+    update(ms);
+    update(p, mp);
+    compare("initialisation");
+    // uniaxial strain loading
+    const auto it = IntegrationType::INTEGRATION_CONSISTENT_TANGENT_OPERATOR;
+    const auto de = 1.e-3;
+    const auto dt = real(1);
+    for (size_type i = 0; i != 20; ++i) {
+      const auto step = "step " + std::to_string(i);
+      for (auto* const m : {&ms, &mp}) {
+        for (size_type idx = 0; idx != n; ++idx) {
+          m->s1.gradients[idx * m->s1.gradients_stride] += de;
+        }
+      }
+      for (const auto revert_first : {true, false}) {
+        const auto rs = integrate(p, ms, it, dt);
+        const auto rp = integrate(p, mp, it, dt);
+        if ((!check(rs != -1, "integration failed (" + step + ")")) ||
+            (!check(rp != -1, "integration failed (" + step + ")"))) {
+          return EXIT_FAILURE;
+        }
+        compare("integration, " + step);
+        if (revert_first) {
+          // the gradients at the end of the time step are lost by revert
+          auto e1 = std::vector<real>(ms.s1.gradients.begin(),
+                                      ms.s1.gradients.end());
+          revert(ms);
+          revert(p, mp);
+          compare("revert, " + step);
+          check(same_values(ms.s0.internal_state_variables,
+                            ms.s1.internal_state_variables),
+                "invalid revert (" + step + ")");
+          check(std::all_of(ms.K.begin(), ms.K.end(),
+                            [](const real v) { return v == 0; }),
+                "the tangent operator shall be reset by revert");
+          for (auto* const m : {&ms, &mp}) {
+            std::copy(e1.begin(), e1.end(), m->s1.gradients.begin());
+          }
+        } else {
+          update(ms);
+          update(p, mp);
+          compare("update, " + step);
+          check(same_values(ms.s0.internal_state_variables,
+                            ms.s1.internal_state_variables),
+                "invalid update (" + step + ")");
+        }
+      }
+    }
+    // the material shall have been plastically strained
+    check(ms.s0.internal_state_variables[op] > 0,
+          "no plastic strain: invalid test");
+    // updateValues
+    MaterialStateManager s1{b, n};
+    MaterialStateManager s2{b, n};
+    updateValues(s1, ms.s0);
+    updateValues(p, s2, mp.s0);
+    check(same_states(s1, s2), "invalid states (updateValues)");
+    check(same_states(s1, ms.s0), "invalid states (updateValues)");
+    // extractInternalStateVariable
+    for (const auto& iv : b.isvs) {
+      const auto size = n * getVariableSize(iv, b.hypothesis);
+      auto vs = std::vector<real>(size);
+      auto vp = std::vector<real>(size);
+      extractInternalStateVariable(vs, ms.s0, iv.name);
+      extractInternalStateVariable(p, vp, mp.s0, iv.name);
+      check(vs == vp, "invalid values for internal state variable '" +
+                          iv.name + "' (extractInternalStateVariable)");
+    }
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}